@@ -277,13 +277,12 @@ void DataStore::loadContacts(DataStoreHost* host) {
       while (!full) {
         ContactInfo c;
         uint8_t pub_key[32];
-        uint8_t unused;
 
         bool success = (file.read(pub_key, 32) == 32);
         success = success && (file.read((uint8_t *)&c.name, 32) == 32);
         success = success && (file.read(&c.type, 1) == 1);
         success = success && (file.read(&c.flags, 1) == 1);
-        success = success && (file.read(&unused, 1) == 1);
+        success = success && (file.read(&c.payload_ver, 1) == 1);   // was 'unused'
         success = success && (file.read((uint8_t *)&c.sync_since, 4) == 4); // was 'reserved'
         success = success && (file.read((uint8_t *)&c.out_path_len, 1) == 1);
         success = success && (file.read((uint8_t *)&c.last_advert_timestamp, 4) == 4);
@@ -295,6 +294,8 @@ void DataStore::loadContacts(DataStoreHost* host) {
         if (!success) break; // EOF
 
         c.id = mesh::Identity(pub_key);
+        if (c.payload_ver > PAYLOAD_VER_2) c.payload_ver = PAYLOAD_VER_1;
+        c.max_payload_ver = c.payload_ver;
         if (!host->onContactLoaded(c)) full = true;
       }
       file.close();
@@ -307,14 +308,13 @@ void DataStore::saveContacts(DataStoreHost* host) {
   if (file) {
     uint32_t idx = 0;
     ContactInfo c;
-    uint8_t unused = 0;
 
     while (host->getContactForSave(idx, c)) {
       bool success = (file.write(c.id.pub_key, 32) == 32);
       success = success && (file.write((uint8_t *)&c.name, 32) == 32);
       success = success && (file.write(&c.type, 1) == 1);
       success = success && (file.write(&c.flags, 1) == 1);
-      success = success && (file.write(&unused, 1) == 1);
+      success = success && (file.write(&c.payload_ver, 1) == 1);
       success = success && (file.write((uint8_t *)&c.sync_since, 4) == 4);
       success = success && (file.write((uint8_t *)&c.out_path_len, 1) == 1);
       success = success && (file.write((uint8_t *)&c.last_advert_timestamp, 4) == 4);
@@ -99,6 +99,7 @@
 #define PUSH_CODE_TELEMETRY_RESPONSE    0x8B
 #define PUSH_CODE_BINARY_RESPONSE       0x8C
 #define PUSH_CODE_PATH_DISCOVERY_RESPONSE 0x8D
+#define PUSH_CODE_BINARY_RESPONSE_PART  0x8E
 
 #define ERR_CODE_UNSUPPORTED_CMD        1
 #define ERR_CODE_NOT_FOUND              2
@@ -157,7 +158,11 @@ void MyMesh::updateContactFromFrame(ContactInfo &contact, uint32_t& last_mod, co
   i += PUB_KEY_SIZE;
   contact.type = frame[i++];
   contact.flags = frame[i++];
-  contact.out_path_len = frame[i++];
+  int8_t out_path_len = frame[i++];
+  if (out_path_len != contact.out_path_len || (out_path_len > 0 && memcmp(contact.out_path, &frame[i], out_path_len) != 0)) {
+    contact.payload_ver = PAYLOAD_VER_1;   // path set by app is in V1 format
+  }
+  contact.out_path_len = out_path_len;
   memcpy(contact.out_path, &frame[i], MAX_PATH_SIZE);
   i += MAX_PATH_SIZE;
   memcpy(contact.name, &frame[i], 32);
@@ -230,8 +235,9 @@ int MyMesh::calcRxDelay(float score, uint32_t air_time) const {
   return (int)((pow(_prefs.rx_delay_base, 0.85f - score) - 1.0) * air_time);
 }
 
-uint8_t MyMesh::getExtraAckTransmitCount() const {
-  return _prefs.multi_acks;
+uint8_t MyMesh::getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) {
+  // multi_acks is now the minimum, more are sent along long or lossy paths
+  return AckLossTable::calcExtraAcks(_prefs.multi_acks, path_len / hash_size, getAckLossPercent(path, path_len));
 }
 
 void MyMesh::logRxRaw(float snr, float rssi, const uint8_t raw[], int len) {
@@ -563,6 +569,51 @@ void MyMesh::onContactResponse(const ContactInfo &contact, const uint8_t *data,
   }
 }
 
+#ifdef WITH_FRAGMENT_TRANSFER
+void MyMesh::onContactLargeResponse(const ContactInfo &contact, const uint8_t *data, int len) {
+  uint32_t tag;
+  memcpy(&tag, data, 4);
+
+  if (len > 4 && tag == pending_req && large_resp_len == 0) {  // check for matching response tag
+    pending_req = 0;
+
+    // too big for one frame, so stream to app in parts (from loop())
+    memcpy(large_resp, data, len);
+    large_resp_len = len;
+    large_resp_offset = 4;
+  } else {
+    BaseChatMesh::onContactLargeResponse(contact, data, len);
+  }
+}
+
+void MyMesh::checkLargeResponse() {
+  if (large_resp_len == 0 || _serial->isWriteBusy()) return;
+
+  int offset = large_resp_offset - 4;   // relative to data after the tag
+  int total = large_resp_len - 4;
+  int chunk_len = large_resp_len - large_resp_offset;
+  if (chunk_len > MAX_FRAME_SIZE - 10) chunk_len = MAX_FRAME_SIZE - 10;
+
+  int i = 0;
+  out_frame[i++] = PUSH_CODE_BINARY_RESPONSE_PART;
+  out_frame[i++] = 0; // reserved
+  memcpy(&out_frame[i], large_resp, 4);   // tag, app needs to match this to RESP_CODE_SENT.tag
+  i += 4;
+  out_frame[i++] = offset & 0xFF;
+  out_frame[i++] = offset >> 8;
+  out_frame[i++] = total & 0xFF;
+  out_frame[i++] = total >> 8;
+  memcpy(&out_frame[i], &large_resp[large_resp_offset], chunk_len);
+  i += chunk_len;
+  _serial->writeFrame(out_frame, i);
+
+  large_resp_offset += chunk_len;
+  if (large_resp_offset >= large_resp_len) {
+    large_resp_len = large_resp_offset = 0;  // all sent
+  }
+}
+#endif
+
 bool MyMesh::onContactPathRecv(ContactInfo& contact, uint8_t* in_path, uint8_t in_path_len, uint8_t* out_path, uint8_t out_path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) {
   if (extra_type == PAYLOAD_TYPE_RESPONSE && extra_len > 4) {
     uint32_t tag;
@@ -618,6 +669,8 @@ void MyMesh::onRawDataRecv(mesh::Packet *packet) {
 
 void MyMesh::onTraceRecv(mesh::Packet *packet, uint32_t tag, uint32_t auth_code, uint8_t flags,
                          const uint8_t *path_snrs, const uint8_t *path_hashes, uint8_t path_len) {
+  BaseChatMesh::onTraceRecv(packet, tag, auth_code, flags, path_snrs, path_hashes, path_len);  // score contact paths
+
   int i = 0;
   out_frame[i++] = PUSH_CODE_TRACE_DATA;
   out_frame[i++] = 0; // reserved
@@ -662,6 +715,9 @@ MyMesh::MyMesh(mesh::Radio &radio, mesh::RNG &rng, mesh::RTCClock &rtc, SimpleMe
   next_ack_idx = 0;
   sign_data = NULL;
   dirty_contacts_expiry = 0;
+#ifdef WITH_FRAGMENT_TRANSFER
+  large_resp_len = large_resp_offset = 0;
+#endif
   memset(advert_paths, 0, sizeof(advert_paths));
 
   // defaults
@@ -710,6 +766,7 @@ void MyMesh::begin(bool has_display) {
   _prefs.sf = constrain(_prefs.sf, 7, 12);
   _prefs.cr = constrain(_prefs.cr, 5, 8);
   _prefs.tx_power_dbm = constrain(_prefs.tx_power_dbm, 1, MAX_LORA_TX_POWER);
+  _prefs.multi_acks = constrain(_prefs.multi_acks, 0, 1);
 
 #ifdef BLE_PIN_CODE // 123456 by default
   if (_prefs.ble_pin == 0) {
@@ -978,6 +1035,7 @@ void MyMesh::handleCmdFrame(size_t len) {
       writeOKFrame();
     } else {
       ContactInfo contact;
+      memset(&contact, 0, sizeof(contact));
       updateContactFromFrame(contact, last_mod, cmd_frame, len);
       contact.lastmod = last_mod;
       contact.sync_since = 0;
@@ -1130,7 +1188,7 @@ void MyMesh::handleCmdFrame(size_t len) {
       if (len >= 4) {
         _prefs.advert_loc_policy = cmd_frame[3];
         if (len >= 5) {
-          _prefs.multi_acks = cmd_frame[4];
+          _prefs.multi_acks = constrain(cmd_frame[4], 0, 1);
         }
       }
     }
@@ -1703,6 +1761,9 @@ void MyMesh::loop() {
     checkCLIRescueCmd();
   } else {
     checkSerialInterface();
+#ifdef WITH_FRAGMENT_TRANSFER
+    checkLargeResponse();
+#endif
   }
 
   // is there are pending dirty contacts write needed?
@@ -105,7 +105,7 @@ protected:
   float getAirtimeBudgetFactor() const override;
   int getInterferenceThreshold() const override;
   int calcRxDelay(float score, uint32_t air_time) const override;
-  uint8_t getExtraAckTransmitCount() const override;
+  uint8_t getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) override;
 
   void logRxRaw(float snr, float rssi, const uint8_t raw[], int len) override;
   bool isAutoAddEnabled() const override;
@@ -128,6 +128,9 @@ protected:
   uint8_t onContactRequest(const ContactInfo &contact, uint32_t sender_timestamp, const uint8_t *data,
                            uint8_t len, uint8_t *reply) override;
   void onContactResponse(const ContactInfo &contact, const uint8_t *data, uint8_t len) override;
+#ifdef WITH_FRAGMENT_TRANSFER
+  void onContactLargeResponse(const ContactInfo &contact, const uint8_t *data, int len) override;
+#endif
   void onRawDataRecv(mesh::Packet *packet) override;
   void onTraceRecv(mesh::Packet *packet, uint32_t tag, uint32_t auth_code, uint8_t flags,
                    const uint8_t *path_snrs, const uint8_t *path_hashes, uint8_t path_len) override;
@@ -163,6 +166,9 @@ private:
 
   void checkCLIRescueCmd();
   void checkSerialInterface();
+#ifdef WITH_FRAGMENT_TRANSFER
+  void checkLargeResponse();
+#endif
 
   // helpers, short-cuts
   void savePrefs() { _store->savePrefs(_prefs, sensors.node_lat, sensors.node_lon); }
@@ -195,6 +201,11 @@ private:
   uint8_t out_frame[MAX_FRAME_SIZE + 1];
   CayenneLPP telemetry;
 
+#ifdef WITH_FRAGMENT_TRANSFER
+  uint8_t large_resp[MAX_TRANSFER_SIZE];   // reassembled RESPONSE, being streamed to app in parts
+  int large_resp_len, large_resp_offset;
+#endif
+
   struct Frame {
     uint8_t len;
     uint8_t buf[MAX_FRAME_SIZE];
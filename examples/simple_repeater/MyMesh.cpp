@@ -55,15 +55,20 @@
 
 #define LAZY_CONTACTS_WRITE_DELAY    5000
 
-void MyMesh::putNeighbour(const mesh::Identity &id, uint32_t timestamp, float snr) {
+bool MyMesh::putNeighbour(const mesh::Identity &id, uint32_t timestamp, float snr, const uint8_t* app_data, size_t app_data_len) {
 #if MAX_NEIGHBOURS // check if neighbours enabled
+  uint32_t now = getRTCClock()->getCurrentTime();
+
   // find existing neighbour, else use least recently updated
   uint32_t oldest_timestamp = 0xFFFFFFFF;
   NeighbourInfo *neighbour = &neighbours[0];
+  bool is_new = true;
   for (int i = 0; i < MAX_NEIGHBOURS; i++) {
     // if neighbour already known, we should update it
     if (id.matches(neighbours[i].id)) {
       neighbour = &neighbours[i];
+      // a neighbour returning after a long silence is also a change
+      is_new = neighbour->heard_timestamp == 0 || neighbour->heard_timestamp + getNeighbourActiveSecs() <= now;
       break;
     }
 
@@ -75,11 +80,134 @@ void MyMesh::putNeighbour(const mesh::Identity &id, uint32_t timestamp, float sn
   }
 
   // update neighbour info
+  if (!id.matches(neighbour->id)) {
+    neighbour->link.clear();   // slot re-used for a different neighbour
+  }
+  neighbour->link.addRevSNR(snr, _prefs.sf);
   neighbour->id = id;
   neighbour->advert_timestamp = timestamp;
-  neighbour->heard_timestamp = getRTCClock()->getCurrentTime();
+  neighbour->heard_timestamp = now;
   neighbour->snr = (int8_t)(snr * 4);
+#if COMPACT_ADVERT_RECV
+  neighbour->app_data_len = app_data_len;
+  memcpy(neighbour->app_data, app_data, app_data_len);
+#endif
+  return is_new;
+#else
+  return false;
+#endif
+}
+
+NeighbourInfo* MyMesh::findNeighbourByHash(const uint8_t* hash, uint8_t hash_size) {
+  NeighbourInfo* found = NULL;
+#if MAX_NEIGHBOURS
+  for (int i = 0; i < MAX_NEIGHBOURS; i++) {
+    if (neighbours[i].heard_timestamp > 0 && neighbours[i].id.isHashMatch(hash, hash_size)) {
+      if (found) return NULL;   // ambiguous
+      found = &neighbours[i];
+    }
+  }
 #endif
+  return found;
+}
+
+uint16_t MyMesh::getNeighbourETX(const uint8_t* hash, uint8_t hash_size) {
+  auto n = findNeighbourByHash(hash, hash_size);
+  return n ? n->link.getETX() : LINK_ETX_UNKNOWN;
+}
+
+uint8_t MyMesh::getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) {
+  // multi_acks is now the minimum, more are sent along long paths, or via a lossy next hop
+  int loss_pct = 0;
+  if (path_len >= hash_size) {
+    uint16_t etx = getNeighbourETX(path, hash_size);
+    if (etx != LINK_ETX_UNKNOWN) loss_pct = 100 - 10000 / etx;
+  }
+  return AckLossTable::calcExtraAcks(_prefs.multi_acks, path_len / hash_size, loss_pct);
+}
+
+void MyMesh::updateLinkQualityRx(const mesh::Packet* pkt) {
+#if MAX_NEIGHBOURS
+  uint8_t hash_size = pkt->getPathHashSize();
+  if (pkt->isRouteFlood()) {
+    if (pkt->path_len >= hash_size) {   // last hop in path is the neighbour who (re)transmitted it, even if a duplicate
+      auto n = findNeighbourByHash(&pkt->path[pkt->path_len - hash_size], hash_size);
+      if (n) n->link.addRevSNR(pkt->getSNR(), _prefs.sf);
+    }
+  } else if (pkt->getPayloadType() == PAYLOAD_TYPE_TRACE) {
+    // path[i] is the SNR hop i measured, receiving from hop i-1. If we've just heard hop i forwarding it, and hop i-1 is us...
+    const int ofs = 9;   // tag(4) + auth(4) + flags(1)
+    int i = pkt->path_len - 1;
+    if (i >= 1 && i < pkt->payload_len - ofs && self_id.isHashMatch(&pkt->payload[ofs + i - 1])) {
+      auto n = findNeighbourByHash(&pkt->payload[ofs + i], PATH_HASH_SIZE);
+      if (n) n->link.addFwdSNR(((int8_t)pkt->path[i]) / 4.0f, _prefs.sf);
+    }
+  } else {
+    uint8_t hash[MAX_HASH_SIZE];
+    pkt->calculatePacketHash(hash);
+    for (int i = 0; i < MAX_IMPLICIT_ACKS; i++) {
+      auto a = &implicit_acks[i];
+      if (a->neighbour && memcmp(a->packet_hash, hash, MAX_HASH_SIZE) == 0) {   // heard next hop forwarding it
+        a->neighbour->link.addRoundTrip(true);
+        a->neighbour = NULL;
+      }
+    }
+  }
+#endif
+}
+
+void MyMesh::expectImplicitAck(const mesh::Packet* pkt, int len) {
+#if MAX_NEIGHBOURS
+  uint8_t type = pkt->getPayloadType();
+  if (!pkt->isRouteDirect() || pkt->path_len < pkt->getPathHashSize()) return;   // not relayed by a neighbour
+  if (!(type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE || type == PAYLOAD_TYPE_TXT_MSG
+      || type == PAYLOAD_TYPE_PATH || type == PAYLOAD_TYPE_ANON_REQ)) return;   // others aren't forwarded as-is
+
+  auto n = findNeighbourByHash(pkt->path, pkt->getPathHashSize());
+  if (n == NULL) return;
+
+  auto a = &implicit_acks[0];
+  for (int i = 1; i < MAX_IMPLICIT_ACKS && a->neighbour; i++) {   // find unused slot, or the one expiring soonest
+    auto b = &implicit_acks[i];
+    if (b->neighbour == NULL || (long)(b->expires - a->expires) < 0) a = b;
+  }
+  pkt->calculatePacketHash(a->packet_hash);
+  a->neighbour = n;
+  a->expires = futureMillis(_radio->getEstAirtimeFor(len) * 3 + IMPLICIT_ACK_EXTRA_MILLIS);
+#endif
+}
+
+void MyMesh::checkImplicitAcks() {
+#if MAX_NEIGHBOURS
+  for (int i = 0; i < MAX_IMPLICIT_ACKS; i++) {
+    auto a = &implicit_acks[i];
+    if (a->neighbour && millisHasNowPassed(a->expires)) {   // never heard next hop forward it
+      a->neighbour->link.addRoundTrip(false);
+      a->neighbour = NULL;
+    }
+  }
+#endif
+}
+
+uint32_t MyMesh::getNeighbourActiveSecs() const {
+  // assume neighbours run the same advert.interval, and back off like we do (see calcAdvertCeiling())
+  uint32_t interval_secs = ((uint32_t)_prefs.advert_interval) * 2 * 60;
+  uint32_t max_secs = ((uint32_t)ADVERT_MAX_INTERVAL_MINS) * 60;
+  if (_prefs.adaptive_adverts) interval_secs <<= ADVERT_BACKOFF_DOUBLINGS + 1;   // incl. the extra doubling, when dense
+  if (interval_secs == 0 || interval_secs > max_secs) interval_secs = max_secs;   // ours are off, so assume the longest
+  return NEIGHBOUR_ACTIVE_ADVERTS * interval_secs;
+}
+
+int MyMesh::countActiveNeighbours() const {
+  int n = 0;
+#if MAX_NEIGHBOURS
+  uint32_t now = getRTCClock()->getCurrentTime();
+  uint32_t active_secs = getNeighbourActiveSecs();
+  for (int i = 0; i < MAX_NEIGHBOURS; i++) {
+    if (neighbours[i].heard_timestamp > 0 && neighbours[i].heard_timestamp + active_secs > now) n++;
+  }
+#endif
+  return n;
 }
 
 uint8_t MyMesh::handleLoginReq(const mesh::Identity& sender, const uint8_t* secret, uint32_t sender_timestamp, const uint8_t* data) {
@@ -116,6 +244,7 @@ uint8_t MyMesh::handleLoginReq(const mesh::Identity& sender, const uint8_t* secr
     client->last_activity = getRTCClock()->getCurrentTime();
     client->permissions |= perms;
     memcpy(client->shared_secret, secret, PUB_KEY_SIZE);
+    mesh::Utils::initHMAC(client->hmac_state, secret, PUB_KEY_SIZE);
 
     if (perms != PERM_ACL_GUEST) {   // keep number of FS writes to a minimum
       dirty_contacts_expiry = futureMillis(LAZY_CONTACTS_WRITE_DELAY);
@@ -158,6 +287,10 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
     stats.n_direct_dups = ((SimpleMeshTables *)getTables())->getNumDirectDups();
     stats.n_flood_dups = ((SimpleMeshTables *)getTables())->getNumFloodDups();
     stats.total_rx_air_time_secs = getReceiveAirTime() / 1000;
+    stats.n_flood_suppressed = getNumFloodSuppressed();
+    stats.n_flood_direct_routed = getNumFloodDirectRouted();
+    stats.n_anon_ecdh = getNumAnonECDH();
+    stats.n_anon_limited = getNumAnonRateLimited();
 
     memcpy(&reply_data[4], &stats, sizeof(stats));
 
@@ -191,7 +324,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
   }
   if (payload[0] == REQ_TYPE_GET_NEIGHBOURS) {
     uint8_t request_version = payload[1];
-    if (request_version == 0) {
+    if (request_version <= 1) {   // version 1 adds link ETX to each entry
 
       // reply data offset (after response sender_timestamp/tag)
       int reply_offset = 4;
@@ -200,7 +333,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
       uint8_t count = payload[2]; // how many neighbours to fetch (0-255)
       uint16_t offset;
       memcpy(&offset, &payload[3], 2); // offset from start of neighbours list (0-65535)
-      uint8_t order_by = payload[5]; // how to order neighbours. 0=newest_to_oldest, 1=oldest_to_newest, 2=strongest_to_weakest, 3=weakest_to_strongest
+      uint8_t order_by = payload[5]; // how to order neighbours. 0=newest_to_oldest, 1=oldest_to_newest, 2=strongest_to_weakest, 3=weakest_to_strongest, 4=best_to_worst_link, 5=worst_to_best_link
       uint8_t pubkey_prefix_length = payload[6]; // how many bytes of neighbour pub key we want
       // we also send a 4 byte random blob in payload[7...10] to help packet uniqueness
 
@@ -248,6 +381,20 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
         std::sort(sorted_neighbours, sorted_neighbours + neighbours_count, [](const NeighbourInfo* a, const NeighbourInfo* b) {
           return a->snr < b->snr; // asc
         });
+      } else if (order_by == 4) {
+        // sort by best to worst link (unknown last)
+        MESH_DEBUG_PRINTLN("REQ_TYPE_GET_NEIGHBOURS sorting best to worst link");
+        std::sort(sorted_neighbours, sorted_neighbours + neighbours_count, [](const NeighbourInfo* a, const NeighbourInfo* b) {
+          return a->link.getETX() < b->link.getETX(); // asc
+        });
+      } else if (order_by == 5) {
+        // sort by worst to best link (unknown last)
+        MESH_DEBUG_PRINTLN("REQ_TYPE_GET_NEIGHBOURS sorting worst to best link");
+        std::sort(sorted_neighbours, sorted_neighbours + neighbours_count, [](const NeighbourInfo* a, const NeighbourInfo* b) {
+          uint16_t a_etx = a->link.getETX(), b_etx = b->link.getETX();
+          if (a_etx == LINK_ETX_UNKNOWN || b_etx == LINK_ETX_UNKNOWN) return b_etx == LINK_ETX_UNKNOWN && a_etx != LINK_ETX_UNKNOWN;
+          return a_etx > b_etx; // desc
+        });
       }
 
       // build results buffer
@@ -257,7 +404,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
       for(int index = 0; index < count && index + offset < neighbours_count; index++){
         
         // stop if we can't fit another entry in results
-        int entry_size = pubkey_prefix_length + 4 + 1;
+        int entry_size = pubkey_prefix_length + 4 + 1 + (request_version >= 1 ? 2 : 0);
         if(results_offset + entry_size > sizeof(results_buffer)){
           MESH_DEBUG_PRINTLN("REQ_TYPE_GET_NEIGHBOURS no more entries can fit in results buffer");
           break;
@@ -269,6 +416,10 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
         memcpy(&results_buffer[results_offset], neighbour->id.pub_key, pubkey_prefix_length); results_offset += pubkey_prefix_length;
         memcpy(&results_buffer[results_offset], &heard_seconds_ago, 4); results_offset += 4;
         memcpy(&results_buffer[results_offset], &neighbour->snr, 1); results_offset += 1;
+        if (request_version >= 1) {
+          uint16_t etx = neighbour->link.getETX();
+          memcpy(&results_buffer[results_offset], &etx, 2); results_offset += 2;
+        }
         results_count++;
 
       }
@@ -285,7 +436,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
   return 0; // unknown command
 }
 
-mesh::Packet *MyMesh::createSelfAdvert() {
+mesh::Packet *MyMesh::createSelfAdvert(bool allow_compact) {
   uint8_t app_data[MAX_ADVERT_DATA_SIZE];
   uint8_t app_data_len;
   {
@@ -293,6 +444,28 @@ mesh::Packet *MyMesh::createSelfAdvert() {
     app_data_len = builder.encodeTo(app_data);
   }
 
+  uint8_t hash[sizeof(self_advert_hash)];
+  mesh::Utils::sha256(hash, sizeof(hash), app_data, app_data_len);
+  if (memcmp(hash, self_advert_hash, sizeof(hash)) != 0) {   // name or location has changed
+    memcpy(self_advert_hash, hash, sizeof(hash));
+    local_adverts.reset();
+    flood_adverts.reset();
+    num_compact_adverts = COMPACT_ADVERTS_PER_FULL;   // next local advert is a full one
+  }
+
+  if (allow_compact && last_full_advert_len > 0 && num_compact_adverts < COMPACT_ADVERTS_PER_FULL) {
+    // neighbours who heard our last full advert only need the fields which have changed since
+    uint8_t delta[ADV_DELTA_HDR_SIZE + MAX_ADVERT_DATA_SIZE];
+    int delta_len = AdvertDeltaHelper::encodeDelta(delta, last_full_advert, last_full_advert_len, app_data, app_data_len);
+    if (delta_len > 0) {
+      num_compact_adverts++;
+      return createCompactAdvert(self_id, app_data, app_data_len, delta, delta_len);
+    }
+  }
+  memcpy(last_full_advert, app_data, app_data_len);
+  last_full_advert_len = app_data_len;
+  num_compact_adverts = 0;
+
   return createAdvert(self_id, app_data, app_data_len);
 }
 
@@ -312,6 +485,36 @@ bool MyMesh::allowPacketForward(const mesh::Packet *packet) {
   return true;
 }
 
+uint8_t MyMesh::getFloodSuppressThreshold(const mesh::Packet *packet) const {
+#if MAX_NEIGHBOURS
+  int n = countActiveNeighbours();   // neighbours recently heard (zero hop)
+  if (n < FLOOD_SUPPRESS_MIN_NEIGHBOURS) return 0;   // sparse, so every re-transmit counts
+
+  // the denser the neighbourhood, the fewer duplicates needed before ours is redundant
+  return 2 + (FLOOD_SUPPRESS_MIN_NEIGHBOURS * 2) / n;
+#else
+  return 0;   // no neighbour info, so always re-transmit
+#endif
+}
+
+void MyMesh::onFloodPathRecv(const uint8_t* src_hash, const mesh::Packet* packet) {
+  if (_prefs.route_cache && packet->getPayloadVer() == PAYLOAD_VER_2) {   // only V2 routes are used, see below
+    route_cache.learn(src_hash, packet->getPathHashSize(), packet->path, packet->path_len, getRTCClock()->getCurrentTime());
+  }
+}
+
+int MyMesh::getDirectRouteFor(const uint8_t* dest_hash, const mesh::Packet* packet, uint8_t* path) {
+  // NOTE: V1 (1-byte) hashes are too likely to collide with some other node, so only re-route V2 packets
+  if (!_prefs.route_cache || packet->getPayloadVer() != PAYLOAD_VER_2) return -1;
+
+  int path_len = route_cache.lookup(dest_hash, packet->getPathHashSize(), getRTCClock()->getCurrentTime(), path);
+  if (path_len > 0) {
+    uint16_t etx = getNeighbourETX(path, packet->getPathHashSize());
+    if (etx != LINK_ETX_UNKNOWN && etx > ROUTE_CACHE_MAX_ETX) return -1;   // first hop is a poor link, so keep flooding
+  }
+  return path_len;
+}
+
 const char *MyMesh::getLogDateTime() {
   static char tmp[32];
   uint32_t now = getRTCClock()->getCurrentTime();
@@ -331,6 +534,8 @@ void MyMesh::logRxRaw(float snr, float rssi, const uint8_t raw[], int len) {
 }
 
 void MyMesh::logRx(mesh::Packet *pkt, int len, float score) {
+  updateLinkQualityRx(pkt);
+
   if (_logging) {
     File f = openAppend(PACKET_LOG_FILE);
     if (f) {
@@ -354,6 +559,8 @@ void MyMesh::logTx(mesh::Packet *pkt, int len) {
 #ifdef WITH_BRIDGE
   bridge.onPacketTransmitted(pkt);
 #endif
+  expectImplicitAck(pkt, len);
+
   if (_logging) {
     File f = openAppend(PACKET_LOG_FILE);
     if (f) {
@@ -413,19 +620,19 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
     if (packet->isRouteFlood()) {
       // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
       mesh::Packet* path = createPathReturn(sender, secret, packet->path, packet->path_len,
-                                            PAYLOAD_TYPE_RESPONSE, reply_data, reply_len);
+                                            PAYLOAD_TYPE_RESPONSE, reply_data, reply_len, packet->getPayloadVer());
       if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
     } else {
-      mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, secret, reply_data, reply_len);
+      mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, secret, reply_data, reply_len, packet->getPayloadVer());
       if (reply) sendFlood(reply, SERVER_RESPONSE_DELAY);
     }
   }
 }
 
-int MyMesh::searchPeersByHash(const uint8_t *hash) {
+int MyMesh::searchPeersByHash(const uint8_t* hash, uint8_t hash_size) {
   int n = 0;
   for (int i = 0; i < acl.getNumClients(); i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
+    if (acl.getClientByIdx(i)->id.isHashMatch(hash, hash_size)) {
       matching_peer_indexes[n++] = i; // store the INDEXES of matching contacts (for subsequent 'peer' methods)
     }
   }
@@ -442,6 +649,14 @@ void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
   }
 }
 
+const mesh::HMACState *MyMesh::getPeerHMACState(int peer_idx) {
+  int i = matching_peer_indexes[peer_idx];
+  if (i >= 0 && i < acl.getNumClients()) {
+    return &acl.getClientByIdx(i)->hmac_state;
+  }
+  return NULL;
+}
+
 void MyMesh::onAdvertRecv(mesh::Packet *packet, const mesh::Identity &id, uint32_t timestamp,
                           const uint8_t *app_data, size_t app_data_len) {
   mesh::Mesh::onAdvertRecv(packet, id, timestamp, app_data, app_data_len); // chain to super impl
@@ -450,11 +665,31 @@ void MyMesh::onAdvertRecv(mesh::Packet *packet, const mesh::Identity &id, uint32
   if (packet->path_len == 0) {
     AdvertDataParser parser(app_data, app_data_len);
     if (parser.isValid() && parser.getType() == ADV_TYPE_REPEATER) { // just keep neigbouring Repeaters
-      putNeighbour(id, timestamp, packet->getSNR());
+      if (putNeighbour(id, timestamp, packet->getSNR(), app_data, app_data_len)) {
+        MESH_DEBUG_PRINTLN("onAdvertRecv: new neighbour, resetting advert intervals");
+        local_adverts.reset();
+        flood_adverts.reset();
+        num_compact_adverts = COMPACT_ADVERTS_PER_FULL;   // they have no base for a compact advert, so send full one next
+      }
     }
   }
 }
 
+#if COMPACT_ADVERT_RECV
+int MyMesh::resolveCompactAdvert(const uint8_t* key_prefix, const uint8_t* delta, int delta_len, mesh::Identity& id, uint8_t app_data[]) {
+#if MAX_NEIGHBOURS
+  for (int i = 0; i < MAX_NEIGHBOURS; i++) {
+    auto n = &neighbours[i];
+    if (n->heard_timestamp > 0 && n->app_data_len > 0 && memcmp(n->id.pub_key, key_prefix, ADVERT_KEY_PREFIX_SIZE) == 0) {
+      id = n->id;
+      return AdvertDeltaHelper::applyDelta(app_data, n->app_data, n->app_data_len, delta, delta_len);
+    }
+  }
+#endif
+  return -1;   // not a known neighbour
+}
+#endif
+
 void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx, const uint8_t *secret,
                             uint8_t *data, size_t len) {
   int i = matching_peer_indexes[sender_idx];
@@ -478,11 +713,11 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
         mesh::Packet *path = createPathReturn(client->id, secret, packet->path, packet->path_len,
-                                              PAYLOAD_TYPE_RESPONSE, reply_data, reply_len);
+                                              PAYLOAD_TYPE_RESPONSE, reply_data, reply_len, packet->getPayloadVer());
         if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
       } else {
         mesh::Packet *reply =
-            createDatagram(PAYLOAD_TYPE_RESPONSE, client->id, secret, reply_data, reply_len);
+            createDatagram(PAYLOAD_TYPE_RESPONSE, client->id, secret, reply_data, reply_len, client->getReplyPayloadVer(packet->getPayloadVer()));
         if (reply) {
           if (client->out_path_len >= 0) { // we have an out_path, so send DIRECT
             sendDirect(reply, client->out_path, client->out_path_len, SERVER_RESPONSE_DELAY);
@@ -515,13 +750,12 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
         mesh::Utils::sha256((uint8_t *)&ack_hash, 4, data, 5 + strlen((char *)&data[5]), client->id.pub_key,
                             PUB_KEY_SIZE);
 
-        mesh::Packet *ack = createAck(ack_hash);
-        if (ack) {
-          if (client->out_path_len < 0) {
-            sendFlood(ack, TXT_ACK_DELAY);
-          } else {
-            sendDirect(ack, client->out_path, client->out_path_len, TXT_ACK_DELAY);
-          }
+        if (client->out_path_len < 0) {
+          mesh::Packet *ack = createAck(ack_hash);   // NOTE: flood ACKs are always V1, for widest reach
+          if (ack) sendFlood(ack, TXT_ACK_DELAY);
+        } else {
+          mesh::Packet *ack = createAck(ack_hash, client->payload_ver);
+          if (ack) sendDirect(ack, client->out_path, client->out_path_len, TXT_ACK_DELAY);
         }
       }
 
@@ -543,7 +777,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
         memcpy(temp, &timestamp, 4);        // mostly an extra blob to help make packet_hash unique
         temp[4] = (TXT_TYPE_CLI_DATA << 2); // NOTE: legacy was: TXT_TYPE_PLAIN
 
-        auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, secret, temp, 5 + text_len);
+        auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, secret, temp, 5 + text_len, client->getReplyPayloadVer(packet->getPayloadVer()));
         if (reply) {
           if (client->out_path_len < 0) {
             sendFlood(reply, CLI_REPLY_DELAY_MILLIS);
@@ -568,6 +802,7 @@ bool MyMesh::onPeerPathRecv(mesh::Packet *packet, int sender_idx, const uint8_t
     auto client = acl.getClientByIdx(i);
 
     memcpy(client->out_path, path, client->out_path_len = path_len); // store a copy of path, for sendDirect()
+    client->payload_ver = packet->getPayloadVer();   // format of the returned path
     client->last_activity = getRTCClock()->getCurrentTime();
   } else {
     MESH_DEBUG_PRINTLN("onPeerPathRecv: invalid peer idx: %d", i);
@@ -580,20 +815,22 @@ bool MyMesh::onPeerPathRecv(mesh::Packet *packet, int sender_idx, const uint8_t
 MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondClock &ms, mesh::RNG &rng,
                mesh::RTCClock &rtc, mesh::MeshTables &tables)
     : mesh::Mesh(radio, ms, rng, rtc, *new StaticPoolPacketManager(32), tables),
-      _cli(board, rtc, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4)
+      local_adverts(ms, rng), flood_adverts(ms, rng), _cli(board, rtc, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4)
 #if defined(WITH_RS232_BRIDGE)
       , bridge(WITH_RS232_BRIDGE, _mgr, &rtc)
 #elif defined(WITH_ESPNOW_BRIDGE)
       , bridge(_mgr, &rtc)
 #endif
 {
-  next_local_advert = next_flood_advert = 0;
+  memset(self_advert_hash, 0, sizeof(self_advert_hash));
+  last_full_advert_len = num_compact_adverts = 0;
   dirty_contacts_expiry = 0;
   set_radio_at = revert_radio_at = 0;
   _logging = false;
 
 #if MAX_NEIGHBOURS
   memset(neighbours, 0, sizeof(neighbours));
+  memset(implicit_acks, 0, sizeof(implicit_acks));
 #endif
 
   // defaults
@@ -614,6 +851,7 @@ MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondCloc
   _prefs.flood_advert_interval = 12; // 12 hours
   _prefs.flood_max = 64;
   _prefs.interference_threshold = 0; // disabled
+  _prefs.adaptive_adverts = 1;
 }
 
 void MyMesh::begin(FILESYSTEM *fs) {
@@ -668,19 +906,27 @@ void MyMesh::sendSelfAdvertisement(int delay_millis) {
 }
 
 void MyMesh::updateAdvertTimer() {
-  if (_prefs.advert_interval > 0) { // schedule local advert timer
-    next_local_advert = futureMillis(((uint32_t)_prefs.advert_interval) * 2 * 60 * 1000);
-  } else {
-    next_local_advert = 0; // stop the timer
-  }
+  // NOTE: advert_interval of zero stops the timer
+  local_adverts.begin(((uint32_t)_prefs.advert_interval) * 2 * 60 * 1000);
 }
 
 void MyMesh::updateFloodAdvertTimer() {
-  if (_prefs.flood_advert_interval > 0) { // schedule flood advert timer
-    next_flood_advert = futureMillis(((uint32_t)_prefs.flood_advert_interval) * 60 * 60 * 1000);
-  } else {
-    next_flood_advert = 0; // stop the timer
-  }
+  // NOTE: flood_advert_interval of zero stops the timer
+  flood_adverts.begin(((uint32_t)_prefs.flood_advert_interval) * 60 * 60 * 1000);
+}
+
+uint32_t MyMesh::calcAdvertCeiling(uint32_t floor_millis, int doublings, uint32_t max_millis) const {
+#if MAX_NEIGHBOURS
+  if (!_prefs.adaptive_adverts) return floor_millis;   // fixed interval
+
+  if (countActiveNeighbours() >= ADVERT_DENSE_NEIGHBOURS) doublings++;   // busy neighbourhood, adverts cost more airtime
+
+  uint32_t ceiling = floor_millis;
+  while (doublings-- > 0 && ceiling <= max_millis / 2) ceiling *= 2;
+  return ceiling > max_millis ? max_millis : ceiling;
+#else
+  return floor_millis;  // no neighbour info, so can't detect changes. Keep fixed interval
+#endif
 }
 
 void MyMesh::dumpLogFile() {
@@ -775,6 +1021,8 @@ void MyMesh::saveIdentity(const mesh::LocalIdentity &new_id) {
 void MyMesh::clearStats() {
   radio_driver.resetStats();
   resetStats();
+  resetFloodSuppressedStats();
+  resetAnonStats();
   ((SimpleMeshTables *)getTables())->resetStats();
 }
 
@@ -833,18 +1081,22 @@ void MyMesh::loop() {
 #endif
 
   mesh::Mesh::loop();
+  checkImplicitAcks();
 
-  if (next_flood_advert && millisHasNowPassed(next_flood_advert)) {
+  if (flood_adverts.isDue()) {
     mesh::Packet *pkt = createSelfAdvert();
     if (pkt) sendFlood(pkt);
 
-    updateFloodAdvertTimer(); // schedule next flood advert
-    updateAdvertTimer();      // also schedule local advert (so they don't overlap)
-  } else if (next_local_advert && millisHasNowPassed(next_local_advert)) {
-    mesh::Packet *pkt = createSelfAdvert();
+    // schedule next flood advert, backing off while the neighbourhood is stable
+    flood_adverts.backoff(calcAdvertCeiling(((uint32_t)_prefs.flood_advert_interval) * 60 * 60 * 1000,
+                                            FLOOD_ADVERT_BACKOFF_DOUBLINGS, ((uint32_t)FLOOD_ADVERT_MAX_INTERVAL_HOURS) * 60 * 60 * 1000));
+    local_adverts.restart();  // also re-schedule local advert (so they don't overlap)
+  } else if (local_adverts.isDue()) {
+    mesh::Packet *pkt = createSelfAdvert(true);
     if (pkt) sendZeroHop(pkt);
 
-    updateAdvertTimer(); // schedule next local advert
+    local_adverts.backoff(calcAdvertCeiling(((uint32_t)_prefs.advert_interval) * 2 * 60 * 1000,
+                                            ADVERT_BACKOFF_DOUBLINGS, ((uint32_t)ADVERT_MAX_INTERVAL_MINS) * 60 * 1000));
   }
 
   if (set_radio_at && millisHasNowPassed(set_radio_at)) { // apply pending (temporary) radio params
@@ -19,6 +19,10 @@
 #include <helpers/AdvertDataHelpers.h>
 #include <helpers/TxtDataHelpers.h>
 #include <helpers/ClientACL.h>
+#include <helpers/AdvertScheduler.h>
+#include <helpers/RouteCache.h>
+#include <helpers/LinkQuality.h>
+#include <helpers/AckLossTable.h>
 #include <RTClib.h>
 #include <target.h>
 
@@ -51,8 +55,49 @@ struct RepeaterStats {
   int16_t  last_snr;   // x 4
   uint16_t n_direct_dups, n_flood_dups;
   uint32_t total_rx_air_time_secs;
+  uint32_t n_flood_suppressed;
+  uint32_t n_flood_direct_routed;
+  uint32_t n_anon_ecdh;          // key exchanges for ANON_REQs (eg. logins)
+  uint32_t n_anon_limited;       // ANON_REQs dropped by rate limits
 };
 
+#ifndef FLOOD_SUPPRESS_MIN_NEIGHBOURS
+  #define FLOOD_SUPPRESS_MIN_NEIGHBOURS   4   // with fewer active neighbours than this, always re-transmit floods
+#endif
+
+#ifndef NEIGHBOUR_ACTIVE_ADVERTS
+  #define NEIGHBOUR_ACTIVE_ADVERTS        3    // neighbour is active while heard within this many of its local advert intervals
+#endif
+
+#ifndef ADVERT_BACKOFF_DOUBLINGS
+  #define ADVERT_BACKOFF_DOUBLINGS        3    // local (zero hop) advert interval can grow up to 8 x advert.interval
+#endif
+
+#ifndef ADVERT_MAX_INTERVAL_MINS
+  #define ADVERT_MAX_INTERVAL_MINS        (8*60)
+#endif
+
+#ifndef FLOOD_ADVERT_BACKOFF_DOUBLINGS
+  #define FLOOD_ADVERT_BACKOFF_DOUBLINGS  1    // flood advert interval can grow up to 2 x flood.advert.interval
+#endif
+
+#ifndef FLOOD_ADVERT_MAX_INTERVAL_HOURS
+  #define FLOOD_ADVERT_MAX_INTERVAL_HOURS 72
+#endif
+
+#ifndef ADVERT_DENSE_NEIGHBOURS
+  #define ADVERT_DENSE_NEIGHBOURS         8    // with this many active neighbours, allow one extra doubling
+#endif
+
+#ifndef COMPACT_ADVERTS_PER_FULL
+  #define COMPACT_ADVERTS_PER_FULL        0    // local adverts sent in compact form, between full ones. Zero to disable
+                                               // NOTE: neighbours on older firmware ignore compact adverts
+#endif
+
+#ifndef COMPACT_ADVERT_RECV
+  #define COMPACT_ADVERT_RECV             0    // 1 = resolve neighbours' compact adverts (keeps their app_data, in RAM)
+#endif
+
 #ifndef MAX_CLIENTS
   #define MAX_CLIENTS           32
 #endif
@@ -62,6 +107,29 @@ struct NeighbourInfo {
   uint32_t advert_timestamp;
   uint32_t heard_timestamp;
   int8_t snr; // multiplied by 4, user should divide to get float value
+#if COMPACT_ADVERT_RECV
+  uint8_t app_data_len;
+  uint8_t app_data[MAX_ADVERT_DATA_SIZE];   // from their last advert, the base for their compact adverts
+#endif
+  LinkQuality link;
+};
+
+#ifndef MAX_IMPLICIT_ACKS
+  #define MAX_IMPLICIT_ACKS    8    // DIRECT packets sent via a neighbour, waiting to hear it forward them
+#endif
+
+#ifndef IMPLICIT_ACK_EXTRA_MILLIS
+  #define IMPLICIT_ACK_EXTRA_MILLIS   2000
+#endif
+
+#ifndef ROUTE_CACHE_MAX_ETX
+  #define ROUTE_CACHE_MAX_ETX   400   // x 100. Don't re-route floods DIRECT via a neighbour with a worse link than this
+#endif
+
+struct PendingImplicitAck {
+  uint8_t packet_hash[MAX_HASH_SIZE];
+  NeighbourInfo* neighbour;   // NULL if slot unused
+  unsigned long expires;
 };
 
 #ifndef FIRMWARE_BUILD_DATE
@@ -78,15 +146,21 @@ struct NeighbourInfo {
 
 class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   FILESYSTEM* _fs;
-  unsigned long next_local_advert, next_flood_advert;
+  AdvertScheduler local_adverts, flood_adverts;
+  uint8_t self_advert_hash[4];
+  uint8_t last_full_advert[MAX_ADVERT_DATA_SIZE];   // app_data of our last full advert
+  uint8_t last_full_advert_len;
+  uint8_t num_compact_adverts;   // since last full one
   bool _logging;
   NodePrefs _prefs;
   CommonCLI _cli;
   uint8_t reply_data[MAX_PACKET_PAYLOAD];
   ClientACL  acl;
+  RouteCache route_cache;
   unsigned long dirty_contacts_expiry;
 #if MAX_NEIGHBOURS
   NeighbourInfo neighbours[MAX_NEIGHBOURS];
+  PendingImplicitAck implicit_acks[MAX_IMPLICIT_ACKS];
 #endif
   CayenneLPP telemetry;
   unsigned long set_radio_at, revert_radio_at;
@@ -101,10 +175,17 @@ class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   ESPNowBridge bridge;
 #endif
 
-  void putNeighbour(const mesh::Identity& id, uint32_t timestamp, float snr);
+  bool putNeighbour(const mesh::Identity& id, uint32_t timestamp, float snr, const uint8_t* app_data, size_t app_data_len);
+  uint32_t getNeighbourActiveSecs() const;
+  int countActiveNeighbours() const;
+  NeighbourInfo* findNeighbourByHash(const uint8_t* hash, uint8_t hash_size);
+  void updateLinkQualityRx(const mesh::Packet* pkt);
+  void expectImplicitAck(const mesh::Packet* pkt, int len);
+  void checkImplicitAcks();
+  uint32_t calcAdvertCeiling(uint32_t floor_millis, int doublings, uint32_t max_millis) const;
   uint8_t handleLoginReq(const mesh::Identity& sender, const uint8_t* secret, uint32_t sender_timestamp, const uint8_t* data);
   int handleRequest(ClientInfo* sender, uint32_t sender_timestamp, uint8_t* payload, size_t payload_len);
-  mesh::Packet* createSelfAdvert();
+  mesh::Packet* createSelfAdvert(bool allow_compact=false);
 
   File openAppend(const char* fname);
 
@@ -123,7 +204,10 @@ protected:
   int calcRxDelay(float score, uint32_t air_time) const override;
 
   uint32_t getRetransmitDelay(const mesh::Packet* packet) override;
+  uint8_t getFloodSuppressThreshold(const mesh::Packet* packet) const override;
   uint32_t getDirectRetransmitDelay(const mesh::Packet* packet) override;
+  void onFloodPathRecv(const uint8_t* src_hash, const mesh::Packet* packet) override;
+  int getDirectRouteFor(const uint8_t* dest_hash, const mesh::Packet* packet, uint8_t* path) override;
 
   int getInterferenceThreshold() const override {
     return _prefs.interference_threshold;
@@ -131,14 +215,16 @@ protected:
   int getAGCResetInterval() const override {
     return ((int)_prefs.agc_reset_interval) * 4000;   // milliseconds
   }
-  uint8_t getExtraAckTransmitCount() const override {
-    return _prefs.multi_acks;
-  }
+  uint8_t getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) override;
 
   void onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, const mesh::Identity& sender, uint8_t* data, size_t len) override;
-  int searchPeersByHash(const uint8_t* hash) override;
+  int searchPeersByHash(const uint8_t* hash, uint8_t hash_size) override;
   void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) override;
+  const mesh::HMACState* getPeerHMACState(int peer_idx) override;
   void onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len);
+#if COMPACT_ADVERT_RECV
+  int resolveCompactAdvert(const uint8_t* key_prefix, const uint8_t* delta, int delta_len, mesh::Identity& id, uint8_t app_data[]) override;
+#endif
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
   bool onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) override;
 
@@ -178,6 +264,11 @@ public:
 
   mesh::LocalIdentity& getSelfId() override { return self_id; }
 
+  /**
+   * \returns  ETX x 100 of link to neighbour with given hash, or LINK_ETX_UNKNOWN
+  */
+  uint16_t getNeighbourETX(const uint8_t* hash, uint8_t hash_size);
+
   void saveIdentity(const mesh::LocalIdentity& new_id) override;
   void clearStats() override;
   void handleCommand(uint32_t sender_timestamp, char* command, char* reply);
@@ -71,7 +71,7 @@ void MyMesh::pushPostToClient(ClientInfo *client, PostInfo &post) {
   mesh::Utils::sha256((uint8_t *)&client->extra.room.pending_ack, 4, reply_data, len, client->id.pub_key, PUB_KEY_SIZE);
   client->extra.room.push_post_timestamp = post.post_timestamp;
 
-  auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, client->shared_secret, reply_data, len);
+  auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, client->shared_secret, reply_data, len, client->getReplyPayloadVer(PAYLOAD_VER_1));
   if (reply) {
     if (client->out_path_len < 0) {
       sendFlood(reply);
@@ -328,6 +328,7 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
       client->last_activity = getRTCClock()->getCurrentTime();
       client->permissions |= perm;
       memcpy(client->shared_secret, secret, PUB_KEY_SIZE);
+      mesh::Utils::initHMAC(client->hmac_state, secret, PUB_KEY_SIZE);
 
       dirty_contacts_expiry = futureMillis(LAZY_CONTACTS_WRITE_DELAY);
     }
@@ -348,10 +349,10 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
     if (packet->isRouteFlood()) {
       // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
       mesh::Packet *path = createPathReturn(sender, client->shared_secret, packet->path, packet->path_len,
-                                            PAYLOAD_TYPE_RESPONSE, reply_data, 13);
+                                            PAYLOAD_TYPE_RESPONSE, reply_data, 13, packet->getPayloadVer());
       if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
     } else {
-      mesh::Packet *reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, client->shared_secret, reply_data, 13);
+      mesh::Packet *reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, client->shared_secret, reply_data, 13, client->getReplyPayloadVer(packet->getPayloadVer()));
       if (reply) {
         if (client->out_path_len >= 0) { // we have an out_path, so send DIRECT
           sendDirect(reply, client->out_path, client->out_path_len, SERVER_RESPONSE_DELAY);
@@ -363,10 +364,10 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
   }
 }
 
-int MyMesh::searchPeersByHash(const uint8_t *hash) {
+int MyMesh::searchPeersByHash(const uint8_t* hash, uint8_t hash_size) {
   int n = 0;
   for (int i = 0; i < acl.getNumClients(); i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
+    if (acl.getClientByIdx(i)->id.isHashMatch(hash, hash_size)) {
       matching_peer_indexes[n++] = i; // store the INDEXES of matching contacts (for subsequent 'peer' methods)
     }
   }
@@ -383,6 +384,21 @@ void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
   }
 }
 
+const mesh::HMACState *MyMesh::getPeerHMACState(int peer_idx) {
+  int i = matching_peer_indexes[peer_idx];
+  if (i >= 0 && i < acl.getNumClients()) {
+    return &acl.getClientByIdx(i)->hmac_state;
+  }
+  return NULL;
+}
+
+void MyMesh::onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) {
+  int i = matching_peer_indexes[sender_idx];
+  if (i >= 0 && i < acl.getNumClients()) {
+    acl.getClientByIdx(i)->max_payload_ver = max_ver;
+  }
+}
+
 void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx, const uint8_t *secret,
                             uint8_t *data, size_t len) {
   int i = matching_peer_indexes[sender_idx];
@@ -391,6 +407,13 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
     return;
   }
   auto client = acl.getClientByIdx(i);
+  if (type == PAYLOAD_TYPE_TXT_MSG && len > 5 && ((data[4] >> 2) & TXT_FLAG_COMPRESSED)) {
+    len = TextCompressor::expandTxtPayload(data, len, MAX_PACKET_PAYLOAD);
+    if (len == 0) {
+      MESH_DEBUG_PRINTLN("onPeerDataRecv: invalid compressed text");
+      return;
+    }
+  }
   if (type == PAYLOAD_TYPE_TXT_MSG && len > 5) { // a CLI command or new Post
     uint32_t sender_timestamp;
     memcpy(&sender_timestamp, data, 4); // timestamp (by sender's RTC clock - which could be wrong)
@@ -445,19 +468,22 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
       uint32_t delay_millis;
       if (send_ack) {
         if (client->out_path_len < 0) {
-          mesh::Packet *ack = createAck(ack_hash);
+          mesh::Packet *ack = createAck(ack_hash);   // NOTE: flood ACKs are always V1, for widest reach
           if (ack) sendFlood(ack, TXT_ACK_DELAY);
           delay_millis = TXT_ACK_DELAY + REPLY_DELAY_MILLIS;
         } else {
+          ack_losses.onAckSent(client->out_path, client->out_path_len, sender_timestamp);
+
           uint32_t d = TXT_ACK_DELAY;
-          if (getExtraAckTransmitCount() > 0) {
-            mesh::Packet *a1 = createMultiAck(ack_hash, 1);
+          uint8_t extra = getExtraAckTransmitCount(client->out_path, client->out_path_len, mesh::Packet::hashSizeFor(client->payload_ver));
+          while (extra > 0) {
+            mesh::Packet *a1 = createMultiAck(ack_hash, extra, client->payload_ver);
             if (a1) sendDirect(a1, client->out_path, client->out_path_len, d);
             d += 300;
+            extra--;
           }
 
-          mesh::Packet *a2 = createAck(ack_hash);
-          if (a2) sendDirect(a2, client->out_path, client->out_path_len, d);
+          sendDirectAck(ack_hash, client->out_path, client->out_path_len, d, client->payload_ver, client->canRecvAckBundle());
           delay_millis = d + REPLY_DELAY_MILLIS;
         }
       } else {
@@ -476,7 +502,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
         // mesh::Utils::sha256((uint8_t *)&expected_ack_crc, 4, temp, 5 + text_len, self_id.pub_key,
         // PUB_KEY_SIZE);
 
-        auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, secret, temp, 5 + text_len);
+        auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, client->id, secret, temp, 5 + text_len, client->getReplyPayloadVer(packet->getPayloadVer()));
         if (reply) {
           if (client->out_path_len < 0) {
             sendFlood(reply, delay_millis + SERVER_RESPONSE_DELAY);
@@ -521,7 +547,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
           uint32_t ack_hash; // calc ACK to prove to sender that we got request
           mesh::Utils::sha256((uint8_t *)&ack_hash, 4, data, 9, client->id.pub_key, PUB_KEY_SIZE);
 
-          auto reply = createAck(ack_hash);
+          auto reply = createAck(ack_hash, client->payload_ver);
           if (reply) {
             reply->payload[reply->payload_len++] = getUnsyncedCount(client); // NEW: add unsynced counter to end of ACK packet
             sendDirect(reply, client->out_path, client->out_path_len, SERVER_RESPONSE_DELAY);
@@ -533,10 +559,10 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
           if (packet->isRouteFlood()) {
             // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
             mesh::Packet *path = createPathReturn(client->id, secret, packet->path, packet->path_len,
-                                                  PAYLOAD_TYPE_RESPONSE, reply_data, reply_len);
+                                                  PAYLOAD_TYPE_RESPONSE, reply_data, reply_len, packet->getPayloadVer());
             if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
           } else {
-            mesh::Packet *reply = createDatagram(PAYLOAD_TYPE_RESPONSE, client->id, secret, reply_data, reply_len);
+            mesh::Packet *reply = createDatagram(PAYLOAD_TYPE_RESPONSE, client->id, secret, reply_data, reply_len, client->getReplyPayloadVer(packet->getPayloadVer()));
             if (reply) {
               if (client->out_path_len >= 0) { // we have an out_path, so send DIRECT
                 sendDirect(reply, client->out_path, client->out_path_len, SERVER_RESPONSE_DELAY);
@@ -560,6 +586,7 @@ bool MyMesh::onPeerPathRecv(mesh::Packet *packet, int sender_idx, const uint8_t
     MESH_DEBUG_PRINTLN("PATH to client, path_len=%d", (uint32_t)path_len);
     auto client = acl.getClientByIdx(i);
     memcpy(client->out_path, path, client->out_path_len = path_len); // store a copy of path, for sendDirect()
+    client->payload_ver = packet->getPayloadVer();   // format of the returned path
     client->last_activity = getRTCClock()->getCurrentTime();
   } else {
     MESH_DEBUG_PRINTLN("onPeerPathRecv: invalid peer idx: %d", i);
@@ -19,6 +19,7 @@
 #include <helpers/TxtDataHelpers.h>
 #include <helpers/CommonCLI.h>
 #include <helpers/ClientACL.h>
+#include <helpers/AckLossTable.h>
 #include <RTClib.h>
 #include <target.h>
 
@@ -93,6 +94,7 @@ class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   NodePrefs _prefs;
   CommonCLI _cli;
   ClientACL acl;
+  AckLossTable ack_losses;
   unsigned long dirty_contacts_expiry;
   uint8_t reply_data[MAX_PACKET_PAYLOAD];
   unsigned long next_push;
@@ -137,14 +139,17 @@ protected:
   int getAGCResetInterval() const override {
     return ((int)_prefs.agc_reset_interval) * 4000;   // milliseconds
   }
-  uint8_t getExtraAckTransmitCount() const override {
-    return _prefs.multi_acks;
+  uint8_t getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) override {
+    // multi_acks is now the minimum, more are sent along long or lossy paths
+    return AckLossTable::calcExtraAcks(_prefs.multi_acks, path_len / hash_size, ack_losses.getLossPercent(path, path_len));
   }
 
   bool allowPacketForward(const mesh::Packet* packet) override;
   void onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, const mesh::Identity& sender, uint8_t* data, size_t len) override;
-  int searchPeersByHash(const uint8_t* hash) override ;
+  int searchPeersByHash(const uint8_t* hash, uint8_t hash_size) override ;
   void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) override;
+  const mesh::HMACState* getPeerHMACState(int peer_idx) override;
+  void onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) override;
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
   bool onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) override;
   void onAckRecv(mesh::Packet* packet, uint32_t ack_crc) override;
@@ -54,6 +54,9 @@
 #define REQ_TYPE_GET_TELEMETRY_DATA  0x03
 #define REQ_TYPE_GET_AVG_MIN_MAX     0x04
 #define REQ_TYPE_GET_ACCESS_LIST     0x05
+#define REQ_TYPE_GET_SERIES_HISTORY  0x06   // response is sent as a (MULTIPART) FragmentTransfer
+
+#define HISTORY_FLAG_CODED           0x01   // requester accepts a coded transfer (FRAG_OP_CODED)
 
 #define RESP_SERVER_LOGIN_OK      0   // response to ANON_REQ
 
@@ -63,6 +66,10 @@
 
 #define ALERT_ACK_EXPIRY_MILLIS         8000   // wait 8 secs for ACKs to alert messages
 
+#define TRANSFER_TIMEOUT_BASE_MILLIS     500
+#define TRANSFER_PERHOP_FACTOR          6.0f
+#define TRANSFER_PERHOP_EXTRA_MILLIS     250
+
 static File openAppend(FILESYSTEM* _fs, const char* fname) {
   #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
     return _fs->open(fname, FILE_O_WRITE);
@@ -237,6 +244,58 @@ uint8_t SensorMesh::handleRequest(uint8_t perms, uint32_t sender_timestamp, uint
   return 0;  // unknown command
 }
 
+bool SensorMesh::startHistoryTransfer(const ClientInfo& client, uint32_t sender_timestamp, const uint8_t* payload, size_t payload_len) {
+  if (payload_len < 6) return false;
+
+  uint8_t* blob = transfers.allocSend(client.id.pub_key, PAYLOAD_TYPE_RESPONSE);
+  if (blob == NULL) return false;   // busy with another transfer
+
+  uint8_t channel = payload[0];
+  uint8_t lpp_type = payload[1];
+  uint32_t start_secs_ago;
+  memcpy(&start_secs_ago, &payload[2], 4);
+  uint8_t flags = payload_len > 6 ? payload[6] : 0;   // older clients send zero padding here
+
+  uint8_t sz = getDataSize(lpp_type);
+  if (sz > 4) return false;   // only scalar types
+  int max_num = (MAX_TRANSFER_SIZE - 14) / sz;
+  if (max_num > MAX_HISTORY_SAMPLES) max_num = MAX_HISTORY_SAMPLES;
+
+  float samples[MAX_HISTORY_SAMPLES];
+  uint32_t newest_time = 0, interval_secs = 0;
+  int n = querySeriesHistory(channel, lpp_type, start_secs_ago, samples, max_num, newest_time, interval_secs);
+  if (n <= 0) return false;
+
+  int ofs = 0;
+  memcpy(&blob[ofs], &sender_timestamp, 4); ofs += 4;   // reflect sender_timestamp back (the 'tag')
+  memcpy(&blob[ofs], &newest_time, 4); ofs += 4;
+  memcpy(&blob[ofs], &interval_secs, 4); ofs += 4;
+  blob[ofs++] = channel;
+  blob[ofs++] = lpp_type;
+  uint32_t mult = getMultiplier(lpp_type);
+  bool is_signed = isSigned(lpp_type);
+  for (int i = 0; i < n; i++) {
+    ofs += putFloat(&blob[ofs], samples[i], sz, mult, is_signed);
+  }
+  return transfers.startSend(ofs, (flags & HISTORY_FLAG_CODED) != 0);
+}
+
+uint32_t SensorMesh::sendTransferPacket(const uint8_t* peer_key, uint8_t mp_header, const uint8_t* data, int len) {
+  ClientInfo* client = acl.getClient(peer_key, PUB_KEY_SIZE);
+  if (client == NULL || client->out_path_len < 0) return 0;   // fragments are only sent DIRECT
+
+  mesh::Packet* pkt = createMultipartDatagram(mp_header, client->id, client->shared_secret, data, len, client->payload_ver);
+  if (pkt == NULL) return 0;
+
+  uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
+  sendDirect(pkt, client->out_path, client->out_path_len);
+  return TRANSFER_TIMEOUT_BASE_MILLIS + (t*TRANSFER_PERHOP_FACTOR + TRANSFER_PERHOP_EXTRA_MILLIS) * (client->out_path_len + 1);
+}
+
+void SensorMesh::onTransferRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* blob, int len) {
+  MESH_DEBUG_PRINTLN("onTransferRecv: large requests not supported");
+}
+
 mesh::Packet* SensorMesh::createSelfAdvert() {
   uint8_t app_data[MAX_ADVERT_DATA_SIZE];
   uint8_t app_data_len;
@@ -260,7 +319,7 @@ void SensorMesh::sendAlert(const ClientInfo* c, Trigger* t) {
   mesh::Utils::sha256((uint8_t *)&t->expected_acks[t->attempt], 4, data, 5 + text_len, self_id.pub_key, PUB_KEY_SIZE);
   t->attempt++;
 
-  auto pkt = createDatagram(PAYLOAD_TYPE_TXT_MSG, c->id, c->shared_secret, data, 5 + text_len);
+  auto pkt = createDatagram(PAYLOAD_TYPE_TXT_MSG, c->id, c->shared_secret, data, 5 + text_len, c->getReplyPayloadVer(PAYLOAD_VER_1));
   if (pkt) {
     if (c->out_path_len >= 0) {  // we have an out_path, so send DIRECT
       sendDirect(pkt, c->out_path, c->out_path_len);
@@ -359,6 +418,7 @@ uint8_t SensorMesh::handleLoginReq(const mesh::Identity& sender, const uint8_t*
     client->last_activity = getRTCClock()->getCurrentTime();
     client->permissions |= PERM_ACL_ADMIN;
     memcpy(client->shared_secret, secret, PUB_KEY_SIZE);
+    mesh::Utils::initHMAC(client->hmac_state, secret, PUB_KEY_SIZE);
 
     dirty_contacts_expiry = futureMillis(LAZY_CONTACTS_WRITE_DELAY);
   }
@@ -460,19 +520,19 @@ void SensorMesh::onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, con
     if (packet->isRouteFlood()) {
       // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
       mesh::Packet* path = createPathReturn(sender, secret, packet->path, packet->path_len,
-                                            PAYLOAD_TYPE_RESPONSE, reply_data, reply_len);
+                                            PAYLOAD_TYPE_RESPONSE, reply_data, reply_len, packet->getPayloadVer());
       if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
     } else {
-      mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, secret, reply_data, reply_len);
+      mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, sender, secret, reply_data, reply_len, packet->getPayloadVer());
       if (reply) sendFlood(reply, SERVER_RESPONSE_DELAY);
     }
   }
 }
 
-int SensorMesh::searchPeersByHash(const uint8_t* hash) {
+int SensorMesh::searchPeersByHash(const uint8_t* hash, uint8_t hash_size) {
   int n = 0;
   for (int i = 0; i < acl.getNumClients() && n < MAX_SEARCH_RESULTS; i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
+    if (acl.getClientByIdx(i)->id.isHashMatch(hash, hash_size)) {
       matching_peer_indexes[n++] = i;  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
     }
   }
@@ -489,20 +549,36 @@ void SensorMesh::getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) {
   }
 }
 
+const mesh::HMACState* SensorMesh::getPeerHMACState(int peer_idx) {
+  int i = matching_peer_indexes[peer_idx];
+  if (i >= 0 && i < acl.getNumClients()) {
+    return &acl.getClientByIdx(i)->hmac_state;
+  }
+  return NULL;
+}
+
+void SensorMesh::onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) {
+  int i = matching_peer_indexes[sender_idx];
+  if (i >= 0 && i < acl.getNumClients()) {
+    acl.getClientByIdx(i)->max_payload_ver = max_ver;
+  }
+}
+
 void SensorMesh::sendAckTo(const ClientInfo& dest, uint32_t ack_hash) {
   if (dest.out_path_len < 0) {
     mesh::Packet* ack = createAck(ack_hash);
     if (ack) sendFlood(ack, TXT_ACK_DELAY);
   } else {
     uint32_t d = TXT_ACK_DELAY;
-    if (getExtraAckTransmitCount() > 0) {
-      mesh::Packet* a1 = createMultiAck(ack_hash, 1);
+    uint8_t extra = getExtraAckTransmitCount(dest.out_path, dest.out_path_len, mesh::Packet::hashSizeFor(dest.payload_ver));
+    while (extra > 0) {
+      mesh::Packet* a1 = createMultiAck(ack_hash, extra, dest.payload_ver);
       if (a1) sendDirect(a1, dest.out_path, dest.out_path_len, d);
       d += 300;
+      extra--;
     }
 
-    mesh::Packet* a2 = createAck(ack_hash);
-    if (a2) sendDirect(a2, dest.out_path, dest.out_path_len, d);
+    sendDirectAck(ack_hash, dest.out_path, dest.out_path_len, d, dest.payload_ver, dest.canRecvAckBundle());
   }
 }
 
@@ -515,11 +591,25 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
 
   ClientInfo* from = acl.getClientByIdx(i);
 
-  if (type == PAYLOAD_TYPE_REQ) {  // request (from a known contact)
+  if (type == PAYLOAD_TYPE_MULTIPART) {
+    transfers.onPacketRecv(from->id.pub_key, data, len);
+  } else if (type == PAYLOAD_TYPE_REQ) {  // request (from a known contact)
     uint32_t timestamp;
     memcpy(&timestamp, data, 4);
 
-    if (timestamp > from->last_timestamp) {  // prevent replay attacks
+    if (timestamp > from->last_timestamp && len > 5 && data[4] == REQ_TYPE_GET_SERIES_HISTORY) {
+      if ((from->permissions & PERM_ACL_ROLE_MASK) < PERM_ACL_READ_ONLY) return;
+      if (!startHistoryTransfer(*from, timestamp, &data[5], len - 5)) return;   // no data, or busy
+
+      from->last_timestamp = timestamp;
+      from->last_activity = getRTCClock()->getCurrentTime();
+
+      if (packet->isRouteFlood()) {
+        // transfer is only sent DIRECT, so let sender know path TO here (their reciprocal path gives us out_path)
+        mesh::Packet* path = createPathReturn(from->id, secret, packet->path, packet->path_len, 0, NULL, 0, packet->getPayloadVer());
+        if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
+      }
+    } else if (timestamp > from->last_timestamp) {  // prevent replay attacks
       uint8_t reply_len = handleRequest(from->isAdmin() ? 0xFF : from->permissions, timestamp, data[4], &data[5], len - 5);
       if (reply_len == 0) return;  // invalid command
 
@@ -529,10 +619,10 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
         mesh::Packet* path = createPathReturn(from->id, secret, packet->path, packet->path_len,
-                                              PAYLOAD_TYPE_RESPONSE, reply_data, reply_len);
+                                              PAYLOAD_TYPE_RESPONSE, reply_data, reply_len, packet->getPayloadVer());
         if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
       } else {
-        mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, from->id, secret, reply_data, reply_len);
+        mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, from->id, secret, reply_data, reply_len, from->getReplyPayloadVer(packet->getPayloadVer()));
         if (reply) {
           if (from->out_path_len >= 0) {  // we have an out_path, so send DIRECT
             sendDirect(reply, from->out_path, from->out_path_len, SERVER_RESPONSE_DELAY);
@@ -559,7 +649,7 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
           if (packet->isRouteFlood()) {
             // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the ACK
             mesh::Packet* path = createPathReturn(from->id, secret, packet->path, packet->path_len,
-                                                  PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4);
+                                                  PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4, packet->getPayloadVer());
             if (path) sendFlood(path, TXT_ACK_DELAY);
           } else {
             sendAckTo(*from, ack_hash);
@@ -587,7 +677,7 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
           memcpy(temp, &timestamp, 4);   // mostly an extra blob to help make packet_hash unique
           temp[4] = (TXT_TYPE_CLI_DATA << 2);
 
-          auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, from->id, secret, temp, 5 + text_len);
+          auto reply = createDatagram(PAYLOAD_TYPE_TXT_MSG, from->id, secret, temp, 5 + text_len, from->getReplyPayloadVer(packet->getPayloadVer()));
           if (reply) {
             if (from->out_path_len < 0) {
               sendFlood(reply, CLI_REPLY_DELAY_MILLIS);
@@ -627,6 +717,7 @@ bool SensorMesh::onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint
   // NOTE: for this impl, we just replace the current 'out_path' regardless, whenever sender sends us a new out_path.
   // FUTURE: could store multiple out_paths per contact, and try to find which is the 'best'(?)
   memcpy(from->out_path, path, from->out_path_len = path_len);  // store a copy of path, for sendDirect()
+  from->payload_ver = packet->getPayloadVer();   // format of the returned path
   from->last_activity = getRTCClock()->getCurrentTime();
 
   // REVISIT: maybe make ALL out_paths non-persisted to minimise flash writes??
@@ -655,7 +746,7 @@ void SensorMesh::onAckRecv(mesh::Packet* packet, uint32_t ack_crc) {
 
 SensorMesh::SensorMesh(mesh::MainBoard& board, mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc, mesh::MeshTables& tables)
      : mesh::Mesh(radio, ms, rng, rtc, *new StaticPoolPacketManager(32), tables),
-      _cli(board, rtc, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4)
+      _cli(board, rtc, &_prefs, this), transfers(*this, ms), telemetry(MAX_PACKET_PAYLOAD - 4)
 {
   next_local_advert = next_flood_advert = 0;
   dirty_contacts_expiry = 0;
@@ -797,6 +888,7 @@ bool  SensorMesh::getGPS(uint8_t channel, float& lat, float& lon, float& alt) {
 
 void SensorMesh::loop() {
   mesh::Mesh::loop();
+  transfers.loop();
 
   if (next_flood_advert && millisHasNowPassed(next_flood_advert)) {
     mesh::Packet* pkt = createSelfAdvert();
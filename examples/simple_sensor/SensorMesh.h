@@ -21,6 +21,7 @@
 #include <helpers/TxtDataHelpers.h>
 #include <helpers/CommonCLI.h>
 #include <helpers/ClientACL.h>
+#include <helpers/FragmentTransfer.h>
 #include <RTClib.h>
 #include <target.h>
 
@@ -44,7 +45,11 @@
 #define MAX_SEARCH_RESULTS      8
 #define MAX_CONCURRENT_ALERTS   4
 
-class SensorMesh : public mesh::Mesh, public CommonCLICallbacks {
+#ifndef MAX_HISTORY_SAMPLES
+  #define MAX_HISTORY_SAMPLES   288   // per REQ_TYPE_GET_SERIES_HISTORY response
+#endif
+
+class SensorMesh : public mesh::Mesh, public CommonCLICallbacks, public FragmentTransferHost {
 public:
   SensorMesh(mesh::MainBoard& board, mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc, mesh::MeshTables& tables);
   void begin(FILESYSTEM* fs);
@@ -106,6 +111,14 @@ protected:
 
   virtual void onSensorDataRead() = 0;   // for app to implement
   virtual int querySeriesData(uint32_t start_secs_ago, uint32_t end_secs_ago, MinMaxAvg dest[], int max_num) = 0;  // for app to implement
+
+  /**
+   * \brief  for app to implement (optional), the raw recorded samples of a series, newest first
+   * \param  newest_time  (out) RTC timestamp of dest[0]
+   * \param  interval_secs  (out) time between samples
+   * \returns  number of samples in dest, zero if series not known
+  */
+  virtual int querySeriesHistory(uint8_t channel, uint8_t lpp_type, uint32_t start_secs_ago, float dest[], int max_num, uint32_t& newest_time, uint32_t& interval_secs) { return 0; }
   virtual bool handleCustomCommand(uint32_t sender_timestamp, char* command, char* reply) { return false; }
 
   // Mesh overrides
@@ -117,13 +130,19 @@ protected:
   int getInterferenceThreshold() const override;
   int getAGCResetInterval() const override;
   void onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, const mesh::Identity& sender, uint8_t* data, size_t len) override;
-  int searchPeersByHash(const uint8_t* hash) override;
+  int searchPeersByHash(const uint8_t* hash, uint8_t hash_size) override;
   void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) override;
+  const mesh::HMACState* getPeerHMACState(int peer_idx) override;
+  void onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) override;
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
   bool onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) override;
   void onAckRecv(mesh::Packet* packet, uint32_t ack_crc) override;
   virtual bool handleIncomingMsg(ClientInfo& from, uint32_t timestamp, uint8_t* data, uint flags, size_t len);
   void sendAckTo(const ClientInfo& dest, uint32_t ack_hash);
+
+  // FragmentTransferHost overrides
+  uint32_t sendTransferPacket(const uint8_t* peer_key, uint8_t mp_header, const uint8_t* data, int len) override;
+  void onTransferRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* blob, int len) override;
 private:
   FILESYSTEM* _fs;
   unsigned long next_local_advert, next_flood_advert;
@@ -131,6 +150,7 @@ private:
   CommonCLI _cli;
   uint8_t reply_data[MAX_PACKET_PAYLOAD];
   ClientACL  acl;
+  FragmentTransfer transfers;
   unsigned long dirty_contacts_expiry;
   CayenneLPP telemetry;
   uint32_t last_read_time;
@@ -145,6 +165,7 @@ private:
 
   uint8_t handleLoginReq(const mesh::Identity& sender, const uint8_t* secret, uint32_t sender_timestamp, const uint8_t* data);
   uint8_t handleRequest(uint8_t perms, uint32_t sender_timestamp, uint8_t req_type, uint8_t* payload, size_t payload_len);
+  bool startHistoryTransfer(const ClientInfo& client, uint32_t sender_timestamp, const uint8_t* payload, size_t payload_len);
   mesh::Packet* createSelfAdvert();
 
   void sendAlert(const ClientInfo* c, Trigger* t);
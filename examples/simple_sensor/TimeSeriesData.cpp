@@ -43,3 +43,18 @@ void TimeSeriesData::calcMinMaxAvg(mesh::RTCClock* clock, uint32_t start_secs_ag
     dest->_max = dest->_min = dest->_avg = NAN;
   }
 }
+
+int TimeSeriesData::getHistory(mesh::RTCClock* clock, uint32_t start_secs_ago, float dest[], int max_num) const {
+  int i = next, n = num_slots;
+  uint32_t ago = clock->getCurrentTime() - last_timestamp;
+  int num_values = 0;
+
+  // start at most recent recording, back-track through to oldest
+  while (n > 0 && num_values < max_num && ago < start_secs_ago) {
+    n--;
+    i = (i + num_slots - 1) % num_slots;  // go back by one
+    dest[num_values++] = data[i];
+    ago += interval_secs;
+  }
+  return num_values;
+}
@@ -25,5 +25,8 @@ public:
 
   void recordData(mesh::RTCClock* clock, float value);
   void calcMinMaxAvg(mesh::RTCClock* clock, uint32_t start_secs_ago, uint32_t end_secs_ago, MinMaxAvg* dest, uint8_t channel, uint8_t lpp_type) const;
+  int getHistory(mesh::RTCClock* clock, uint32_t start_secs_ago, float dest[], int max_num) const;   // newest first
+  uint32_t getLastTimestamp() const { return last_timestamp; }
+  uint32_t getIntervalSecs() const { return interval_secs; }
 };
 
@@ -31,6 +31,14 @@ protected:
     return 1;
   }
 
+  int querySeriesHistory(uint8_t channel, uint8_t lpp_type, uint32_t start_secs_ago, float dest[], int max_num, uint32_t& newest_time, uint32_t& interval_secs) override {
+    if (channel != TELEM_CHANNEL_SELF || lpp_type != LPP_VOLTAGE) return 0;  // unknown series
+
+    newest_time = battery_data.getLastTimestamp();
+    interval_secs = battery_data.getIntervalSecs();
+    return battery_data.getHistory(getRTCClock(), start_secs_ago, dest, max_num);
+  }
+
   bool handleCustomCommand(uint32_t sender_timestamp, char* command, char* reply) override {
     if (strcmp(command, "magic") == 0) {    // example 'custom' command handling
       strcpy(reply, "**Magic now done**");
@@ -0,0 +1,188 @@
+#include <string.h>
+#include "ed_25519.h"
+#include "sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+/*
+Checks all signatures at once, with random 128-bit multipliers z_i:
+
+  [sum(z_i*s_i)]B - sum(z_i*R_i) - sum(z_i*h_i*A_i) == 0
+
+The second and third terms are summed together by one multi-scalar multiplication (interleaved sliding windows),
+so the 253 doublings are shared by all the signatures, instead of done for each one.
+
+If this fails, at least one signature is invalid, and the caller must verify them individually to find which.
+*/
+
+static signed char naf_a[ED25519_BATCH_MAX][256];
+static signed char naf_r[ED25519_BATCH_MAX][256];
+static ge_cached tbl_a[ED25519_BATCH_MAX][4];   /* -A,-3A,-5A,-7A */
+static ge_cached tbl_r[ED25519_BATCH_MAX][4];   /* -R,-3R,-5R,-7R */
+
+/* width 4 non-adjacent form: odd digits -7..7 */
+static void slide4(signed char *r, const unsigned char *a) {
+    int i;
+    int b;
+    int k;
+
+    for (i = 0; i < 256; ++i) {
+        r[i] = 1 & (a[i >> 3] >> (i & 7));
+    }
+
+    for (i = 0; i < 256; ++i)
+        if (r[i]) {
+            for (b = 1; b <= 3 && i + b < 256; ++b) {
+                if (r[i + b]) {
+                    if (r[i] + (r[i + b] << b) <= 7) {
+                        r[i] += r[i + b] << b;
+                        r[i + b] = 0;
+                    } else if (r[i] - (r[i + b] << b) >= -7) {
+                        r[i] -= r[i + b] << b;
+
+                        for (k = i + b; k < 256; ++k) {
+                            if (!r[k]) {
+                                r[k] = 1;
+                                break;
+                            }
+
+                            r[k] = 0;
+                        }
+                    } else {
+                        break;
+                    }
+                }
+            }
+        }
+}
+
+static void odd_multiples(ge_cached *t, const ge_p3 *p) {
+    ge_p1p1 s;
+    ge_p3 p2;
+    ge_p3 u;
+    int i;
+
+    ge_p3_to_cached(&t[0], p);
+    ge_p3_dbl(&s, p);
+    ge_p1p1_to_p3(&p2, &s);
+
+    for (i = 1; i < 4; ++i) {
+        ge_add(&s, &p2, &t[i - 1]);
+        ge_p1p1_to_p3(&u, &s);
+        ge_p3_to_cached(&t[i], &u);
+    }
+}
+
+static void add_digit(ge_p1p1 *t, const ge_cached *tbl, signed char d) {
+    ge_p3 u;
+
+    if (d > 0) {
+        ge_p1p1_to_p3(&u, t);
+        ge_add(t, &u, &tbl[d / 2]);
+    } else if (d < 0) {
+        ge_p1p1_to_p3(&u, t);
+        ge_sub(t, &u, &tbl[(-d) / 2]);
+    }
+}
+
+int ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens,
+                         const unsigned char *const *public_keys, const unsigned char *const *neg_xs, size_t count,
+                         const unsigned char *random_scalars) {
+    static const unsigned char zero[32] = {0};
+    unsigned char s_sum[32] = {0};
+    unsigned char z[32] = {0};
+    unsigned char hz[32];
+    unsigned char h[64];
+    unsigned char check[32];
+    sha512_context hash;
+    ge_p3 A;
+    ge_p3 R;
+    ge_p3 u;
+    ge_p1p1 t;
+    ge_p2 r;
+    ge_cached sB;
+    size_t n;
+    int i;
+
+    if (count == 0 || count > ED25519_BATCH_MAX) {
+        return 0;
+    }
+
+    for (n = 0; n < count; ++n) {
+        const unsigned char *sig = signatures[n];
+
+        if (!sc_is_canonical(sig + 32)) {
+            return 0;
+        }
+        if (neg_xs && neg_xs[n]) {
+            ge_frombytes_negx(&A, neg_xs[n], public_keys[n]);
+        } else if (ge_frombytes_negate_vartime(&A, public_keys[n]) != 0) {
+            return 0;
+        }
+        if (ge_frombytes_negate_vartime(&R, sig) != 0) {
+            return 0;
+        }
+
+        sha512_init(&hash);
+        sha512_update(&hash, sig, 32);
+        sha512_update(&hash, public_keys[n], 32);
+        sha512_update(&hash, messages[n], message_lens[n]);
+        sha512_final(&hash, h);
+        sc_reduce(h);
+
+        memcpy(z, random_scalars + 16*n, 16);  /* upper half stays zero */
+        z[0] |= 1;                              /* odd, so z*T is never zero for a small order component T */
+        sc_muladd(hz, z, h, zero);
+        sc_muladd(s_sum, z, sig + 32, s_sum);
+
+        slide4(naf_a[n], hz);
+        slide4(naf_r[n], z);
+        odd_multiples(tbl_a[n], &A);
+        odd_multiples(tbl_r[n], &R);
+    }
+
+    /* r = sum(z_i*h_i*(-A_i)) + sum(z_i*(-R_i)) */
+    ge_p2_0(&r);
+    ge_p3_0(&u);
+    for (i = 255; i >= 0; --i) {
+        for (n = 0; n < count; ++n) {
+            if (naf_a[n][i] || naf_r[n][i]) {
+                break;
+            }
+        }
+        if (n < count) {
+            break;
+        }
+    }
+
+    for (; i >= 0; --i) {
+        ge_p2_dbl(&t, &r);
+
+        for (n = 0; n < count; ++n) {
+            add_digit(&t, tbl_a[n], naf_a[n][i]);
+            add_digit(&t, tbl_r[n], naf_r[n][i]);
+        }
+
+        ge_p1p1_to_p2(&r, &t);
+        if (i == 0) {
+            ge_p1p1_to_p3(&u, &t);
+        }
+    }
+
+    /* ... + [sum(z_i*s_i)]B, should be the identity (encoded as y = 1) */
+    ge_scalarmult_base(&A, s_sum);
+    ge_p3_to_cached(&sB, &A);
+    ge_add(&t, &u, &sB);
+    ge_p1p1_to_p3(&u, &t);
+    ge_p3_tobytes(check, &u);
+
+    if (check[0] != 1) {
+        return 0;
+    }
+    for (i = 1; i < 32; ++i) {
+        if (check[i] != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
@@ -18,6 +18,10 @@
 #endif
 
 
+#ifndef ED25519_BATCH_MAX
+    #define ED25519_BATCH_MAX  8
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -30,6 +34,14 @@ void ED25519_DECLSPEC ed25519_create_keypair(unsigned char *public_key, unsigned
 void ED25519_DECLSPEC ed25519_derive_pub(unsigned char *public_key, const unsigned char *private_key);
 void ED25519_DECLSPEC ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+/* neg_x (32 bytes) is the decompressed form of public_key, so repeated verifies by the same key can skip the square root. returns 0 if not a valid point */
+int ED25519_DECLSPEC ed25519_decompress_key(unsigned char *neg_x, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_negx(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *neg_x);
+/* returns 1 only if ALL are valid. random_scalars is 16 random bytes per signature. count up to ED25519_BATCH_MAX.
+   neg_xs is optional (can be NULL, or have NULL entries), from ed25519_decompress_key() */
+int ED25519_DECLSPEC ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens,
+                                          const unsigned char *const *public_keys, const unsigned char *const *neg_xs, size_t count,
+                                          const unsigned char *random_scalars);
 void ED25519_DECLSPEC ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, const unsigned char *scalar);
 void ED25519_DECLSPEC ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key);
 
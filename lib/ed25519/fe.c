@@ -1,6 +1,8 @@
 #include "fixedint.h"
 #include "fe.h"
 
+#if !ED25519_FE64
+
 
 /*
     helper functions
@@ -359,7 +361,12 @@ void fe_frombytes(fe h, const unsigned char *s) {
     h[9] = (int32_t) h9;
 }
 
+#endif  /* !ED25519_FE64 */
+
 
+#if ED25519_COUNT_FE_OPS
+unsigned long fe_mul_count = 0, fe_sq_count = 0;
+#endif
 
 void fe_invert(fe out, const fe z) {
     fe t0;
@@ -449,6 +456,8 @@ void fe_invert(fe out, const fe z) {
 
 
 
+#if !ED25519_FE64
+
 /*
     return 1 if f is in {1,3,5,...,q-2}
     return 0 if f is in {0,2,4,...,q-1}
@@ -762,6 +771,7 @@ void fe_mul(fe h, const fe f, const fe g) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    FE_COUNT(fe_mul_count);
 }
 
 
@@ -877,6 +887,9 @@ void fe_neg(fe h, const fe f) {
     h[9] = h9;
 }
 
+#endif  /* !ED25519_FE64 */
+
+
 
 void fe_pow22523(fe out, const fe z) {
     fe t0;
@@ -964,6 +977,9 @@ void fe_pow22523(fe out, const fe z) {
 }
 
 
+
+#if !ED25519_FE64
+
 /*
 h = f * f
 Can overlap h with f.
@@ -1124,6 +1140,7 @@ void fe_sq(fe h, const fe f) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    FE_COUNT(fe_sq_count);
 }
 
 
@@ -1297,6 +1314,7 @@ void fe_sq2(fe h, const fe f) {
     h[7] = (int32_t) h7;
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
+    FE_COUNT(fe_sq_count);
 }
 
 
@@ -1489,3 +1507,5 @@ void fe_tobytes(unsigned char *s, const fe h) {
     s[30] = (unsigned char) (h9 >> 10);
     s[31] = (unsigned char) (h9 >> 18);
 }
+
+#endif  /* !ED25519_FE64 */
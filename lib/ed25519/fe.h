@@ -4,16 +4,51 @@
 #include "fixedint.h"
 
 
+/*
+    ED25519_FE64 selects the 64-bit backend (fe64.c), with 5 limbs of 51 bits and 128-bit products, which is much
+    quicker on 64-bit hosts. By default it is used wherever the compiler has unsigned __int128 (ie. not on the MCUs).
+*/
+#ifndef ED25519_FE64
+    #if defined(__SIZEOF_INT128__)
+        #define ED25519_FE64  1
+    #else
+        #define ED25519_FE64  0
+    #endif
+#endif
+
+
+/*
+    ED25519_COUNT_FE_OPS counts the calls of fe_mul() in fe_mul_count, and of fe_sq()/fe_sq2() in fe_sq_count, for
+    comparing configurations by work done rather than by (noisy) host timings. See test/bench_sign.c. Off by default.
+*/
+#ifndef ED25519_COUNT_FE_OPS
+    #define ED25519_COUNT_FE_OPS  0
+#endif
+
+#if ED25519_COUNT_FE_OPS
+extern unsigned long fe_mul_count, fe_sq_count;
+#define FE_COUNT(n)  ((n)++)
+#else
+#define FE_COUNT(n)
+#endif
+
+
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
     An element t, entries t[0]...t[9], represents the integer
     t[0]+2^26 t[1]+2^51 t[2]+2^77 t[3]+2^102 t[4]+...+2^230 t[9].
     Bounds on each t[i] vary depending on context.
-*/
 
+    With ED25519_FE64, entries t[0]...t[4] represent the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4], each kept below 2^52.
+*/
 
+#if ED25519_FE64
+typedef uint64_t fe[5];
+#else
 typedef int32_t fe[10];
+#endif
 
 
 void fe_0(fe h);
@@ -1,5 +1,9 @@
 #include "ge.h"
+#if ED25519_FE64
+#include "precomp_data64.h"
+#else
 #include "precomp_data.h"
+#endif
 
 
 /*
@@ -130,6 +134,15 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 }
 
 
+#if ED25519_FE64
+static const fe d = {
+    0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb, 0x52036cee2b6ff
+};
+
+static const fe sqrtm1 = {
+    0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e, 0x2b8324804fc1d
+};
+#else
 static const fe d = {
     -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
 };
@@ -137,6 +150,7 @@ static const fe d = {
 static const fe sqrtm1 = {
     -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
 };
+#endif
 
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe u;
@@ -180,6 +194,16 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     return 0;
 }
 
+/*
+h = the same point as ge_frombytes_negate_vartime(s), given its (already negated) x, ie. skipping the square root
+*/
+void ge_frombytes_negx(ge_p3 *h, const unsigned char *neg_x, const unsigned char *s) {
+    fe_frombytes(h->X, neg_x);
+    fe_frombytes(h->Y, s);
+    fe_1(h->Z);
+    fe_mul(h->T, h->X, h->Y);
+}
+
 
 /*
 r = p + q
@@ -295,9 +319,15 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
+#if ED25519_FE64
+static const fe d2 = {
+    0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff
+};
+#else
 static const fe d2 = {
     -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
 };
+#endif
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -353,21 +383,21 @@ static void cmov(ge_precomp *t, const ge_precomp *u, unsigned char b) {
 }
 
 
-static void select(ge_precomp *t, int pos, signed char b) {
+static void select(ge_precomp *t, const ge_precomp row[8], signed char b) {
     ge_precomp minust;
     unsigned char bnegative = negative(b);
     unsigned char babs = b - (((-bnegative) & b) << 1);
     fe_1(t->yplusx);
     fe_1(t->yminusx);
     fe_0(t->xy2d);
-    cmov(t, &base[pos][0], equal(babs, 1));
-    cmov(t, &base[pos][1], equal(babs, 2));
-    cmov(t, &base[pos][2], equal(babs, 3));
-    cmov(t, &base[pos][3], equal(babs, 4));
-    cmov(t, &base[pos][4], equal(babs, 5));
-    cmov(t, &base[pos][5], equal(babs, 6));
-    cmov(t, &base[pos][6], equal(babs, 7));
-    cmov(t, &base[pos][7], equal(babs, 8));
+    cmov(t, &row[0], equal(babs, 1));
+    cmov(t, &row[1], equal(babs, 2));
+    cmov(t, &row[2], equal(babs, 3));
+    cmov(t, &row[3], equal(babs, 4));
+    cmov(t, &row[4], equal(babs, 5));
+    cmov(t, &row[5], equal(babs, 6));
+    cmov(t, &row[6], equal(babs, 7));
+    cmov(t, &row[7], equal(babs, 8));
     fe_copy(minust.yplusx, t->yminusx);
     fe_copy(minust.yminusx, t->yplusx);
     fe_neg(minust.xy2d, t->xy2d);
@@ -387,7 +417,9 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     signed char e[64];
     signed char carry;
     ge_p1p1 r;
+#if ED25519_BASE_TABLES != 64
     ge_p2 s;
+#endif
     ge_precomp t;
     int i;
 
@@ -411,8 +443,15 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     /* each e[i] is between -8 and 8 */
     ge_p3_0(h);
 
+#if ED25519_BASE_TABLES == 64
+    for (i = 0; i < 64; ++i) {
+        select(&t, (i & 1) ? base16[i / 2] : base[i / 2], e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+#else
     for (i = 1; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
+        select(&t, base[i / 2], e[i]);
         ge_madd(&r, h, &t);
         ge_p1p1_to_p3(h, &r);
     }
@@ -427,10 +466,11 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     ge_p1p1_to_p3(h, &r);
 
     for (i = 0; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
+        select(&t, base[i / 2], e[i]);
         ge_madd(&r, h, &t);
         ge_p1p1_to_p3(h, &r);
     }
+#endif
 }
 
 
@@ -4,6 +4,19 @@
 #include "fe.h"
 
 
+/*
+    Fixed-base tables of ge_scalarmult_base() (ie. signing and key generation):
+    ED25519_BASE_TABLES 32 (30KB) covers every second 4-bit position, and needs 4 doublings to fill in the rest.
+    64 (60KB) covers them all, so has no doublings. Measured with test/bench_sign.c, that is 715 instead of 744 field
+    multiplications and squarings per signature, ie. only 3.9% fewer, for another 30KB of flash. (host timings were
+    within their own noise, so it is not worth it unless signing dominates)
+    Wider windows were tried, but with constant time lookups of the bigger rows they end up slower.
+*/
+#ifndef ED25519_BASE_TABLES
+    #define ED25519_BASE_TABLES  32
+#endif
+
+
 /*
 ge means group element.
 
@@ -54,6 +67,7 @@ typedef struct {
 void ge_p3_tobytes(unsigned char *s, const ge_p3 *h);
 void ge_tobytes(unsigned char *s, const ge_p2 *h);
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
+void ge_frombytes_negx(ge_p3 *h, const unsigned char *neg_x, const unsigned char *s);
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
@@ -1389,3 +1389,1353 @@ static const ge_precomp base[32][8] = {
         },
     },
 };
+
+#if ED25519_BASE_TABLES == 64
+/* base16[i][j] = (j+1)*16*256^i*B, ie. the odd 4-bit positions missing from base[][] (see ED25519_BASE_TABLES) */
+static const ge_precomp base16[32][8] = {
+    {
+        {
+            { 26223094, 21047627, 66291269, 26979893, 48694908, 13765385, 18686369, 30157583, 59418191, 5303411 },
+            { 20852211, 1340053, 51802073, 6107715, 43797011, 8966631, 49417369, 17857750, 46508456, 20170819 },
+            { 42650283, 27205477, 15021040, 7419977, 24989846, 1575285, 65644021, 14432788, 36926482, 8836378 },
+        },
+        {
+            { 25502095, 10391924, 40282401, 29503524, 40391901, 3269110, 7668966, 19701772, 58689262, 33034325 },
+            { 42500931, 33429032, 27759913, 11704479, 54016849, 29308154, 35579866, 7225003, 39624363, 2725106 },
+            { 39544819, 11085235, 49466582, 12970676, 66933323, 5844176, 41292965, 26626567, 38830394, 22652173 },
+        },
+        {
+            { 28030621, 12483271, 41913038, 28147522, 48874196, 26662509, 34060947, 5155061, 24723735, 13276372 },
+            { 39978904, 3588873, 44652291, 13304689, 24473799, 11062727, 24979328, 5931312, 13919550, 6259887 },
+            { 56919095, 26290615, 66828916, 13385853, 29420949, 20585125, 43163734, 9247088, 58254534, 2360015 },
+        },
+        {
+            { 1486129, 257970, 33324453, 14599991, 21718373, 12985333, 59488635, 19366396, 11555298, 17584140 },
+            { 60646683, 21424089, 6177104, 17308058, 58991405, 9121955, 16433140, 14850752, 11457245, 14449899 },
+            { 66108589, 6078, 25942700, 24546360, 37411900, 8709792, 63445480, 13501443, 35448758, 19982699 },
+        },
+        {
+            { 20816093, 1931570, 19511135, 20680137, 48548362, 13026400, 52419578, 3158042, 64923244, 28813084 },
+            { 12122773, 2690359, 8480807, 32203956, 35402713, 24897580, 4373012, 11230151, 52897322, 32638262 },
+            { 5110002, 4273512, 5925105, 5605386, 65793721, 22874520, 5648810, 2137817, 1243403, 23769385 },
+        },
+        {
+            { 25121076, 8602287, 29936647, 26676893, 33695524, 26787171, 46701763, 4635620, 19352480, 7360883 },
+            { 46737672, 30186190, 3938505, 1520415, 22365898, 1723267, 26933925, 18368749, 65112566, 7239311 },
+            { 32757571, 923933, 54388317, 24860462, 14249518, 5990430, 18635548, 12333130, 1140694, 9249959 },
+        },
+        {
+            { 17407951, 18296967, 50112770, 9855302, 18142982, 2391553, 65073828, 8245276, 54768279, 19496097 },
+            { 7843304, 24849128, 51622665, 23646041, 14745054, 22337428, 37076756, 21977341, 61781955, 23535084 },
+            { 39636834, 24496456, 25934453, 889001, 38037710, 17365117, 30398125, 29850390, 45382047, 29103489 },
+        },
+        {
+            { 18572419, 13390462, 65817448, 19583333, 45537137, 19408819, 21104945, 18551039, 18527391, 25306490 },
+            { 58435938, 27763845, 22819839, 15232814, 40024988, 25366596, 39275030, 22611966, 48596275, 29702020 },
+            { 16280600, 20757315, 66755901, 9451950, 47297560, 12151783, 47205378, 5076883, 50173660, 30378904 },
+        },
+    },
+    {
+        {
+            { 37353426, 6305834, 44274427, 1218101, 14106849, 30234026, 33180035, 7098280, 16480428, 22738139 },
+            { 41699800, 31464213, 63787596, 6706120, 1684499, 30161227, 61547249, 26891475, 6948744, 24270554 },
+            { 18131284, 21393475, 55706968, 27567535, 61592018, 33061466, 63029588, 1219797, 51935678, 3647926 },
+        },
+        {
+            { 44595578, 12246325, 48644791, 26203680, 33281395, 9110981, 1027358, 27223328, 7679660, 2842418 },
+            { 54846891, 28300572, 6370636, 4487386, 57166178, 22432559, 65624574, 3910608, 8734779, 23900642 },
+            { 20187343, 21289118, 62032450, 1625265, 61619292, 4035686, 31030596, 26154246, 41373699, 2419198 },
+        },
+        {
+            { 11080326, 5771544, 41670429, 2341830, 33357664, 25845293, 989407, 10996986, 7088054, 32247336 },
+            { 35051454, 2062734, 39451810, 14997401, 42852351, 747391, 48204834, 8416794, 26888753, 27825324 },
+            { 57250035, 4617588, 54416347, 31382133, 21515962, 12161333, 7668390, 30071009, 66527840, 23296853 },
+        },
+        {
+            { 51369099, 22333846, 19995469, 25992701, 36012552, 30768680, 23370032, 2652913, 47424968, 31967824 },
+            { 21052791, 31943546, 13610780, 11319631, 63528935, 24815590, 29919089, 7572283, 29080032, 27952237 },
+            { 46697961, 9161069, 2962171, 22374288, 9727647, 21935332, 36160503, 28614966, 29083303, 32916140 },
+        },
+        {
+            { 45335447, 32046373, 10896192, 12876401, 4668072, 24452080, 38562515, 18091954, 32835805, 6796376 },
+            { 50424830, 19505385, 23966553, 7312936, 37831037, 14955946, 8826854, 32689516, 4594063, 6718517 },
+            { 64808650, 9123233, 32090817, 2372390, 33346979, 8403512, 16034065, 8360168, 51746149, 18935658 },
+        },
+        {
+            { 14319862, 30622381, 66853593, 3129731, 34152697, 7314852, 2700503, 15679648, 17420152, 7455050 },
+            { 53803593, 247073, 43786063, 25276457, 4308013, 31655869, 3913713, 2081858, 10346090, 13245188 },
+            { 55482580, 27228321, 25953885, 21875696, 5442955, 6333322, 15626037, 17304304, 44738474, 8779607 },
+        },
+        {
+            { 42733256, 29879919, 5263739, 29825104, 191391, 23875436, 30183126, 12667180, 48619375, 1840681 },
+            { 9313968, 32584713, 65688502, 17460133, 58841695, 5645140, 21859230, 19702733, 33002916, 33464072 },
+            { 53606015, 12628278, 56982845, 4752871, 62167030, 6086068, 626606, 24758489, 20581561, 13551728 },
+        },
+        {
+            { 48467035, 32402455, 41481045, 7354576, 50230453, 20130058, 53950196, 14873053, 24830217, 7401132 },
+            { 8228401, 27573762, 8316608, 29266827, 64189208, 32135523, 41095218, 1778868, 48606230, 26636252 },
+            { 63616944, 11306417, 7963539, 27278814, 32872269, 4872405, 35891240, 20056654, 45167010, 2607489 },
+        },
+    },
+    {
+        {
+            { 19274469, 28428987, 2025248, 13387528, 40557119, 20316567, 8572281, 27852477, 59503286, 3755889 },
+            { 66105099, 29556084, 37677590, 5708147, 20949970, 22789428, 2582994, 4041757, 28570893, 242978 },
+            { 24217466, 683998, 12990241, 18573503, 24711441, 2582675, 48404236, 22981024, 27632804, 10325174 },
+        },
+        {
+            { 65732571, 10581089, 17601840, 31377029, 43439086, 2515959, 7946113, 5265099, 36542926, 15659180 },
+            { 11690190, 33297493, 38672931, 7575498, 56735502, 8175928, 65439379, 26848259, 37920400, 11378245 },
+            { 3934808, 32658582, 14579490, 29392678, 26542054, 14629900, 47442910, 12702561, 57324877, 17728442 },
+        },
+        {
+            { 59203560, 25987285, 24242008, 23572446, 57103315, 2864672, 54675868, 33264061, 34916249, 21174186 },
+            { 21648519, 5875995, 41371437, 5595485, 65029766, 2667115, 36973995, 24267996, 2742569, 29528540 },
+            { 49478460, 28779253, 49552289, 20768317, 22223082, 9281306, 25269654, 16741825, 7733910, 29258628 },
+        },
+        {
+            { 18931893, 27574669, 8372850, 31737680, 17694525, 29972924, 39978473, 31145722, 18843965, 27673939 },
+            { 31572522, 1387635, 39581090, 1197913, 51553188, 13484266, 54368726, 13093863, 20957081, 29939996 },
+            { 11695398, 22486381, 55879211, 23597494, 53685776, 6286990, 6574490, 25011294, 35115933, 30301545 },
+        },
+        {
+            { 4406854, 33350845, 23268838, 17365683, 3696358, 30529122, 64734479, 19506241, 25835548, 14199049 },
+            { 58055184, 9666136, 17702016, 13681030, 31673492, 26007836, 25994290, 7426565, 11705204, 33055428 },
+            { 57404207, 7750858, 4780558, 23675404, 3972006, 32281181, 9397470, 6020439, 9390255, 19896687 },
+        },
+        {
+            { 63070772, 4122773, 15819690, 30864771, 32461320, 5475061, 7223123, 15194198, 6509018, 22648763 },
+            { 57569320, 2095848, 29789961, 61126, 24968268, 19973257, 64525989, 21328489, 13866992, 1421457 },
+            { 62894608, 28836432, 22567783, 3736576, 19253254, 29197927, 28225721, 19334357, 2798084, 8570919 },
+        },
+        {
+            { 45953673, 19550533, 8717305, 22153744, 17970582, 10837346, 31185163, 26938168, 6612498, 19293363 },
+            { 8368971, 26020528, 62024339, 4262329, 745608, 13759847, 51820630, 15767428, 64994476, 32131879 },
+            { 16253406, 21428892, 5328055, 520783, 7323359, 28487242, 25388760, 21050636, 13788610, 15592195 },
+        },
+        {
+            { 49101223, 22254536, 44129818, 15904832, 42642340, 31123573, 14251254, 20078212, 30848990, 13037900 },
+            { 113900, 16486627, 15167557, 19793886, 21770964, 26558441, 13113952, 32205066, 35522976, 10056457 },
+            { 25229681, 21287786, 5569511, 8982737, 32063203, 27973336, 65671194, 4966334, 13017505, 11031479 },
+        },
+    },
+    {
+        {
+            { 59361441, 9283211, 16885577, 15459439, 25972200, 15573013, 33572156, 522133, 39536699, 11723470 },
+            { 2772024, 16117691, 1948422, 1594977, 11683210, 14644609, 19125577, 22035751, 36910020, 29406622 },
+            { 52138145, 17167090, 53069532, 22280331, 13553526, 6014471, 8651844, 4302826, 944768, 9457783 },
+        },
+        {
+            { 25367933, 9925423, 1217074, 10032740, 15893633, 26269412, 46107679, 13591836, 15590119, 6888531 },
+            { 66055837, 30350799, 51620670, 5115516, 47171518, 3036255, 50176368, 9411691, 11827739, 22911048 },
+            { 11974655, 3048430, 66337636, 28555912, 48024334, 32517513, 27844684, 12465445, 47483338, 20767190 },
+        },
+        {
+            { 41152192, 21298619, 24522557, 23808136, 43456841, 230924, 9724355, 20888721, 7329541, 29927505 },
+            { 20097826, 18713554, 58947839, 28932705, 32179127, 11048424, 27972941, 1059821, 14340256, 14287005 },
+            { 13600793, 23591530, 20158994, 8659885, 54699605, 11574469, 34314640, 1224149, 4403633, 25836348 },
+        },
+        {
+            { 7654641, 7028247, 38417256, 540978, 47828166, 28160327, 9795208, 8516409, 13848267, 32055132 },
+            { 30465468, 19678762, 357143, 27280804, 62460536, 10924292, 4789084, 2863329, 27548793, 27360466 },
+            { 4433141, 3224307, 64302100, 5354429, 31289755, 33093101, 22067863, 28841007, 2154527, 4684644 },
+        },
+        {
+            { 65704887, 31812622, 24799459, 10590365, 1395551, 25051003, 28864880, 25008050, 31138021, 32262204 },
+            { 49276676, 27132530, 26054945, 24057972, 35430565, 11448777, 40456649, 6547851, 18183957, 6621583 },
+            { 38808954, 12504929, 40518394, 2262324, 47551329, 972637, 11625555, 13979573, 28514419, 213985 },
+        },
+        {
+            { 24519105, 21956543, 37663950, 20587187, 27722450, 28458001, 61422082, 16364259, 8723084, 14806813 },
+            { 58492157, 12913565, 807665, 3681606, 63965585, 31855303, 23760371, 21394639, 23694806, 12446998 },
+            { 38971816, 5428050, 6680625, 9942468, 45573368, 1824312, 46310491, 14263049, 29191327, 16544139 },
+        },
+        {
+            { 9398589, 21991429, 55461877, 17606492, 1349979, 5197359, 48627340, 3237353, 52185134, 16891446 },
+            { 26283039, 29868068, 2459089, 17170327, 43220287, 9598008, 53151095, 18828312, 66768636, 26009760 },
+            { 51977956, 12798751, 47059916, 909823, 20905484, 16479172, 46606141, 32812815, 29265752, 21192949 },
+        },
+        {
+            { 13874797, 20177965, 30152725, 19598233, 43783799, 13021370, 42974264, 14450791, 13790612, 23135623 },
+            { 18487447, 935344, 33624237, 25110582, 11904659, 6601985, 59358331, 16303925, 51601745, 26628228 },
+            { 47348898, 11298844, 14718846, 13623030, 50128113, 6469662, 48097137, 11615537, 11731611, 768756 },
+        },
+    },
+    {
+        {
+            { 46850229, 26433964, 11453540, 27221587, 32959412, 13781704, 56585080, 10616929, 59733557, 11149821 },
+            { 4536578, 26430134, 27508501, 7816921, 29384726, 30589214, 30191587, 21968214, 36850892, 21939636 },
+            { 77135, 15628759, 39667012, 9328399, 3300633, 22900938, 51984819, 8300022, 12084288, 3054740 },
+        },
+        {
+            { 49835420, 14034145, 11836332, 28772820, 25536069, 11173207, 8964775, 29320650, 25146891, 13305965 },
+            { 43803681, 21380928, 31479649, 17582412, 49329232, 19205782, 66876229, 3747944, 41956055, 32406719 },
+            { 27133824, 586572, 45660943, 805819, 62853951, 701431, 41781581, 7219466, 1516428, 4919925 },
+        },
+        {
+            { 58299714, 15205856, 29876534, 8214191, 25802562, 24122527, 6190965, 10041152, 6949444, 5277385 },
+            { 65550185, 2968831, 24781098, 15495403, 8788080, 16966928, 23862281, 22453764, 12990748, 9708672 },
+            { 2402247, 17736611, 64923988, 444290, 1247189, 20888028, 19858949, 27030967, 4491849, 11195713 },
+        },
+        {
+            { 6109946, 32184519, 26057600, 26201852, 23168325, 24371888, 3992654, 2862676, 15421102, 30148563 },
+            { 51338732, 9030043, 17073626, 718504, 39883705, 6870037, 32915018, 4714511, 35344926, 29511403 },
+            { 41036865, 7984757, 39021697, 8099323, 43635591, 2221417, 17986974, 23361409, 19196844, 14943647 },
+        },
+        {
+            { 49418763, 12669672, 20380407, 24479788, 59434810, 29420990, 6120569, 23930877, 57086252, 20116737 },
+            { 37043996, 23301870, 7087358, 7207762, 19996121, 5645904, 31617719, 9156087, 40545818, 2059451 },
+            { 29720950, 995338, 61612396, 1238410, 23470990, 15773069, 50989550, 5301622, 46612867, 32390065 },
+        },
+        {
+            { 3697523, 28924991, 26797663, 971220, 57289733, 9864025, 67011940, 17478379, 35328810, 29073446 },
+            { 13794480, 9444875, 16235673, 18865995, 57403148, 13901470, 32089413, 29996627, 24520429, 30016530 },
+            { 16614970, 19844223, 18395784, 5370482, 12553636, 8976933, 14955496, 19258245, 59578162, 5174392 },
+        },
+        {
+            { 33211681, 32338887, 9045063, 25918122, 13201556, 26310572, 30174130, 9936993, 56948874, 8077410 },
+            { 23153077, 13841946, 22477413, 12324549, 60122335, 1190804, 26252247, 20316537, 16454665, 17277375 },
+            { 173744, 3663982, 58369734, 3806569, 35667485, 12952788, 8828535, 12263775, 61045980, 30517393 },
+        },
+        {
+            { 14238189, 20321438, 50884057, 2003323, 8999610, 29347255, 23598909, 10246308, 18611982, 27293901 },
+            { 58432246, 7221066, 57293478, 27901922, 20976676, 26432621, 65508066, 32056421, 21150528, 8555924 },
+            { 50548549, 19752800, 31420780, 26279184, 12463559, 6639844, 38423261, 15035684, 14966100, 21920742 },
+        },
+    },
+    {
+        {
+            { 65051156, 19759819, 42975546, 25091467, 51254210, 11926894, 24462524, 23153436, 58416649, 21396437 },
+            { 57624965, 153322, 31677098, 14319101, 1299253, 816448, 51865749, 5297073, 4923922, 11471160 },
+            { 19188905, 16119364, 34718476, 2999379, 32178693, 24130037, 45712578, 22848889, 48802703, 25742825 },
+        },
+        {
+            { 54137459, 13407110, 40376885, 25954346, 6443507, 25958766, 46838740, 30213995, 39322337, 33456144 },
+            { 50317846, 29122497, 2967929, 14371159, 58203015, 21971632, 28841648, 5898474, 54901025, 25002246 },
+            { 42739461, 12934400, 46124970, 21944427, 33605109, 25988573, 64386167, 20121119, 62614590, 33191845 },
+        },
+        {
+            { 38617309, 19896488, 42204672, 8921750, 48765286, 10764852, 36663473, 14544952, 25829926, 20111527 },
+            { 40207779, 2465511, 24265387, 17090380, 39790195, 11775405, 59395511, 27214357, 42945848, 17326207 },
+            { 62416513, 19570945, 44524471, 16013619, 2128896, 298625, 65484098, 4556698, 36958815, 31636549 },
+        },
+        {
+            { 23409036, 7340959, 29156936, 15107907, 60488599, 29396006, 26665341, 28860977, 41928195, 27276306 },
+            { 55622332, 29029634, 25022594, 20005124, 5513672, 29475693, 38262748, 28030050, 47002327, 3415914 },
+            { 22717419, 9458330, 31735608, 6303028, 57315505, 26449470, 34720831, 10252173, 19973013, 8665651 },
+        },
+        {
+            { 67005478, 3954765, 10159466, 12760864, 58985203, 5644139, 7905446, 26354262, 9241230, 21415407 },
+            { 10951686, 8420484, 33830280, 24616445, 27891586, 20329207, 23178780, 15226760, 51930608, 22784566 },
+            { 55791897, 25088755, 18096126, 30341256, 64119413, 3908389, 41235149, 14571455, 18304282, 6456444 },
+        },
+        {
+            { 41574188, 26162868, 14352250, 31741192, 62930706, 6595632, 28183879, 30452351, 38846882, 1288879 },
+            { 57391657, 14510799, 17156110, 12896498, 41619163, 23040745, 475506, 22819641, 57651392, 12709966 },
+            { 59422183, 21235826, 35480718, 4907648, 66096401, 5640353, 54050215, 26913763, 25962256, 18049404 },
+        },
+        {
+            { 30993100, 29334242, 13906474, 9376137, 60481105, 21293902, 36826268, 7722926, 57108256, 29986255 },
+            { 28847797, 20011004, 30031975, 23726309, 46492557, 33270995, 5967047, 12842824, 34943720, 31079283 },
+            { 58652298, 24288442, 56917088, 16484182, 26784716, 12868456, 1277658, 26714910, 4939054, 21294414 },
+        },
+        {
+            { 49499371, 29401570, 47565764, 5098038, 37760016, 12420370, 24509421, 32517282, 43549272, 25650909 },
+            { 53057694, 18391089, 12298458, 8559429, 19812335, 24533641, 60801256, 4484219, 38509066, 13843189 },
+            { 28825931, 23708882, 42521816, 12656476, 42979141, 21514292, 58583355, 2482306, 49465096, 27742585 },
+        },
+    },
+    {
+        {
+            { 17912713, 17461733, 43632171, 3944827, 56591252, 26375218, 20648130, 3965321, 25469530, 30112178 },
+            { 17267777, 4369299, 20216911, 25615267, 36589065, 12392098, 51998277, 24006102, 46833764, 29892691 },
+            { 57320208, 11359471, 29586899, 21758827, 1321282, 33509689, 28967382, 3240535, 56908774, 938825 },
+        },
+        {
+            { 37045668, 5835116, 38985383, 32819165, 5676681, 24108422, 36265521, 10343789, 42211635, 31942230 },
+            { 25095668, 29922401, 41462186, 15666420, 59623739, 24735797, 10553093, 15233358, 57178814, 15528460 },
+            { 26598773, 10725764, 17168817, 21032653, 43258722, 22575542, 48578769, 22104705, 37198982, 25392218 },
+        },
+        {
+            { 20858808, 7716357, 46237344, 10528023, 48145821, 22910243, 57957154, 22102565, 1577262, 20548239 },
+            { 58844505, 11670044, 5858996, 20364292, 23445498, 27768403, 62453229, 13678962, 1684698, 23601876 },
+            { 23771014, 19595540, 38254874, 17470637, 23423948, 16920769, 48831085, 3775197, 42476980, 2402239 },
+        },
+        {
+            { 22439197, 6073835, 48427366, 30539102, 352365, 5109476, 10943265, 17425849, 30589586, 12639673 },
+            { 64025299, 25195634, 57666528, 24840597, 30259460, 26074759, 2234641, 10981484, 53435399, 7924041 },
+            { 22652316, 6515168, 41843282, 13236280, 28274803, 13460880, 62736805, 2427595, 46451532, 21981875 },
+        },
+        {
+            { 19725744, 21688545, 27358000, 11194039, 11732154, 22725243, 15818701, 30617119, 18322842, 20770352 },
+            { 13150166, 30340583, 20334996, 8011597, 20261326, 16121344, 33068193, 15359641, 60546032, 427263 },
+            { 66216978, 28471819, 16059062, 4783539, 7017123, 24611826, 65005557, 7854756, 27722026, 12635359 },
+        },
+        {
+            { 47381969, 21967614, 1381101, 12172594, 53355022, 20237093, 396979, 27616766, 29854146, 10125267 },
+            { 1875324, 17336483, 42070698, 28890329, 518916, 5982423, 46709705, 6516689, 23468862, 22012597 },
+            { 9267085, 1044336, 23257472, 18609513, 20340926, 15041265, 53864153, 21534735, 18740242, 10858954 },
+        },
+        {
+            { 45659550, 9208182, 4856822, 17186889, 18443178, 7494936, 31493197, 16398886, 2498321, 9215196 },
+            { 64680855, 16222924, 9858848, 13520177, 54787096, 22756888, 43161002, 16257347, 29699595, 11384160 },
+            { 37648774, 22082776, 6981536, 1446853, 27152467, 6395638, 33056313, 22500808, 33039454, 31513360 },
+        },
+        {
+            { 1151868, 21471520, 54860108, 24344480, 52085521, 20942162, 17683375, 20952800, 27176315, 4618238 },
+            { 32070273, 9778898, 28212468, 8406405, 21384023, 719879, 7526632, 31918500, 1232677, 24467424 },
+            { 11738445, 12055293, 17975421, 27297956, 51986685, 867095, 53764739, 22618077, 54383776, 13257294 },
+        },
+    },
+    {
+        {
+            { 166972, 17578039, 15612706, 21139646, 3859798, 10068474, 15791766, 8882529, 53204647, 17440875 },
+            { 5878335, 22524063, 10377566, 32549480, 40287156, 21053940, 34519408, 1330440, 20157226, 5246228 },
+            { 56405309, 28419754, 32878463, 10118550, 50919987, 20436642, 48801277, 21171467, 4281975, 2841433 },
+        },
+        {
+            { 59932319, 19024401, 17755938, 24754261, 13593435, 17966851, 59931912, 11682801, 49458681, 21599920 },
+            { 24898741, 9496464, 5033731, 6719600, 19600974, 9612324, 29526147, 4615092, 36363825, 4637078 },
+            { 50115398, 32984102, 65701899, 2180913, 57002229, 23440046, 981039, 16855704, 61740224, 17798000 },
+        },
+        {
+            { 29542051, 31371499, 59940173, 28789643, 54764707, 4582133, 29160811, 24632410, 6050303, 18576926 },
+            { 20489495, 11664490, 39597954, 22645765, 18661538, 30221642, 2854781, 18999279, 2555759, 30643409 },
+            { 56395928, 28557, 6884883, 28254188, 19667818, 19072788, 423571, 25710257, 16634612, 11281690 },
+        },
+        {
+            { 50307114, 31791456, 44641138, 9434439, 57157033, 24620955, 27827119, 30331916, 34734545, 7290745 },
+            { 50449302, 30571437, 20476664, 10859803, 34590947, 4205785, 51758541, 32468050, 17401997, 27646749 },
+            { 6969762, 9774089, 61999433, 16204798, 56163063, 19100154, 29242246, 31120168, 9253112, 27763148 },
+        },
+        {
+            { 63439619, 3129506, 31416816, 26988742, 27965530, 19715747, 66397163, 20274088, 9391827, 25579734 },
+            { 39239344, 10677333, 58280043, 30571114, 65268518, 21545077, 20734474, 12867382, 57575723, 16434109 },
+            { 17014661, 26677156, 55917133, 32487321, 50571165, 420499, 54930104, 29080850, 8518314, 15782726 },
+        },
+        {
+            { 67100889, 12772299, 32978859, 8517266, 27953488, 6824388, 65789529, 7161176, 11931082, 25259237 },
+            { 10460864, 21682088, 17958899, 25014557, 7777517, 14231236, 30537017, 7189523, 18087307, 14485069 },
+            { 43851474, 1423638, 20207261, 28533949, 62890273, 6221437, 40350223, 26342944, 29919857, 12403424 },
+        },
+        {
+            { 64639530, 21702697, 4851050, 28452056, 13157068, 12165049, 40033874, 21257816, 9797748, 32289181 },
+            { 6820283, 9377919, 124462, 4395148, 41079105, 26826579, 10086819, 33140433, 55584594, 13780628 },
+            { 47353055, 5857807, 63388330, 9870102, 4940095, 20418127, 61172209, 30310736, 33015651, 13484 },
+        },
+        {
+            { 43296939, 18735887, 25006788, 7818556, 2841551, 24394831, 23314566, 26841745, 56274639, 31033828 },
+            { 7162471, 8520820, 66873256, 2918151, 50065426, 21527518, 6511582, 21307150, 23271855, 28879308 },
+            { 47553183, 2820405, 33606357, 32605367, 52653524, 21779097, 60879687, 2263279, 30370950, 23213588 },
+        },
+    },
+    {
+        {
+            { 63271262, 13045717, 28443955, 15948611, 39530058, 19094195, 37761571, 33302016, 38421721, 11603312 },
+            { 52702444, 916948, 39733495, 6685200, 9811730, 31008965, 25034224, 25230404, 29022370, 19114149 },
+            { 16286527, 32661280, 25911488, 29774127, 3806293, 2014063, 60982667, 16894622, 19533295, 32451870 },
+        },
+        {
+            { 5383362, 20195329, 53101469, 14372649, 30801004, 9041537, 29182249, 2690795, 33646390, 7189272 },
+            { 63387225, 33092618, 54259856, 2632907, 19840529, 11366335, 38514030, 14080559, 12447689, 22862460 },
+            { 23299736, 6701149, 1736245, 32994643, 13956934, 10200200, 37263782, 6434962, 42220254, 26208697 },
+        },
+        {
+            { 38493879, 24097652, 10429490, 6686314, 24709062, 30056158, 238112, 28113893, 26162615, 1842414 },
+            { 26722664, 17306841, 15809067, 312980, 41799120, 5749279, 57931929, 31621909, 27292486, 13656831 },
+            { 15020244, 18471699, 54434311, 3791599, 2986753, 28549918, 41403788, 5841099, 34943760, 12718937 },
+        },
+        {
+            { 33759741, 20585885, 56300365, 8713649, 33524436, 13108626, 65689413, 4669468, 61585143, 30368173 },
+            { 59009453, 28174255, 36092990, 2560817, 5636160, 24385563, 12687447, 15176521, 15747510, 15632705 },
+            { 28990134, 11360283, 28664170, 8248719, 44322108, 17081909, 11077325, 12281365, 53974846, 27283171 },
+        },
+        {
+            { 51740201, 20092348, 18136626, 25360297, 5092565, 17144252, 41401285, 8240041, 49434499, 32854474 },
+            { 54601665, 19666188, 65319690, 29628383, 4289553, 1601359, 16514210, 18881385, 59501835, 6136736 },
+            { 53729863, 31576939, 54475293, 15578905, 216825, 10284750, 21305294, 7030757, 59913508, 24406957 },
+        },
+        {
+            { 35366773, 32500653, 67084888, 16716573, 48314760, 8654287, 64151982, 13009256, 12372728, 33165048 },
+            { 30237642, 26930374, 17252019, 9506435, 27013206, 22071990, 44772752, 5535245, 30475505, 8645734 },
+            { 26853664, 17791899, 66849842, 24260700, 35143804, 15227277, 24684743, 12160374, 10472519, 31120778 },
+        },
+        {
+            { 36618419, 24930388, 11380808, 26301355, 22421014, 10597312, 2953892, 1303465, 13457662, 25319035 },
+            { 23234298, 13840477, 45059875, 12499536, 57621324, 7519718, 26349813, 18689998, 9507612, 522337 },
+            { 15563273, 33218282, 51611607, 31402003, 19396362, 1152040, 31927966, 32065693, 22800711, 14124973 },
+        },
+        {
+            { 40684660, 22773404, 53256863, 32602781, 15474995, 10668212, 24279721, 13459047, 60871681, 23505601 },
+            { 24350163, 12173425, 58579835, 28152696, 65477592, 15818484, 11878433, 10161213, 33224202, 15370052 },
+            { 39758885, 20648740, 48697079, 2293915, 6365638, 11138129, 60922879, 21547878, 15502954, 6395806 },
+        },
+    },
+    {
+        {
+            { 35356314, 25101729, 9056472, 3887422, 64654529, 32060823, 54080464, 33382444, 14026797, 1572583 },
+            { 27775727, 11317923, 17097773, 15519649, 14265191, 31276149, 39616551, 30168524, 28653833, 16836837 },
+            { 20930873, 33466365, 26662082, 19439411, 25414359, 21269156, 6256601, 3300085, 5699050, 32023754 },
+        },
+        {
+            { 23302914, 17895966, 65378067, 10126899, 19633094, 1767878, 28234852, 196118, 55863409, 15155200 },
+            { 3008648, 7723116, 29614439, 32936458, 24990777, 14788928, 64105489, 24327383, 65000519, 1321149 },
+            { 38853495, 17747177, 24529007, 15586857, 28229536, 28824344, 10491542, 14278611, 46363322, 11365883 },
+        },
+        {
+            { 20629748, 17830744, 15045842, 23057599, 20984048, 30327312, 8546575, 18731240, 54026314, 7111038 },
+            { 66391791, 18018144, 51172983, 13395091, 21118002, 12052078, 62047204, 18557052, 37373945, 4053334 },
+            { 38474556, 19615220, 18967229, 32178630, 17856593, 2912238, 54644971, 26594476, 29916686, 352087 },
+        },
+        {
+            { 52344100, 26559797, 11694756, 716682, 60297058, 21882551, 40870022, 17433231, 53494652, 21647045 },
+            { 55886141, 32232512, 23862868, 2970041, 56525509, 27513968, 14464258, 3040525, 47719520, 26518416 },
+            { 63762982, 3678290, 57828474, 7081143, 38477079, 22290011, 12367404, 19861868, 51118623, 16945463 },
+        },
+        {
+            { 63295637, 6001746, 610521, 13100340, 63452418, 2550365, 52348132, 22668518, 23425436, 15149273 },
+            { 52488810, 1729107, 12786517, 9069328, 61362831, 17561790, 16672132, 27134976, 36259817, 14144416 },
+            { 59225948, 1821659, 922346, 16783959, 51942074, 13848022, 2847189, 11658201, 34489358, 1403951 },
+        },
+        {
+            { 44252578, 11014875, 14395810, 11475721, 23018800, 4512103, 38484727, 22385181, 13805957, 26421458 },
+            { 24337682, 6840162, 54406285, 11481877, 57523359, 3757697, 30512181, 31765497, 5056154, 14216704 },
+            { 12882221, 2328185, 30241579, 7398702, 62861549, 6002901, 24457341, 16984228, 45211210, 29463278 },
+        },
+        {
+            { 39067945, 3151952, 57807954, 24507498, 63671050, 11271707, 36466107, 14154212, 31997282, 546283 },
+            { 41354817, 7885910, 472867, 3830780, 44469131, 32649481, 59934110, 15822500, 51036795, 30779852 },
+            { 60425099, 27642502, 66488264, 22279937, 12139417, 14398666, 19151799, 11300916, 42527952, 6967611 },
+        },
+        {
+            { 2319062, 2758214, 56063848, 29119080, 48659797, 25516534, 5903290, 7033251, 41210466, 10160191 },
+            { 17011570, 4670548, 14408373, 29150801, 12275166, 20343659, 16864894, 20100142, 29190401, 1884324 },
+            { 30155509, 21456890, 49253521, 13190890, 26931544, 19151313, 32936114, 23668986, 47110904, 19352006 },
+        },
+    },
+    {
+        {
+            { 1466912, 6920868, 81906, 24305551, 63477066, 26271612, 63106111, 32976831, 65062710, 20809791 },
+            { 57435657, 25464474, 52893330, 2884954, 43860986, 29522527, 14654683, 19373710, 15170241, 21095439 },
+            { 64896564, 4413815, 66432095, 9818066, 54305558, 1459472, 3636451, 26252089, 4498006, 9916704 },
+        },
+        {
+            { 16919381, 17892722, 37733775, 788853, 22709065, 28728845, 55633131, 23387653, 50156323, 17170756 },
+            { 65646959, 574385, 53196717, 921131, 3852007, 28750335, 31744586, 32231208, 35699628, 12484285 },
+            { 38315483, 30382690, 488607, 3533994, 48867552, 30783069, 40949667, 6255599, 39162781, 5734943 },
+        },
+        {
+            { 60178232, 17177534, 58372370, 451356, 19038266, 23862425, 300532, 13382813, 21800307, 23602677 },
+            { 6034582, 1921245, 2196036, 32428483, 57408755, 7455567, 63673238, 29179036, 26430430, 15139308 },
+            { 63563605, 23218885, 29296040, 26495364, 54579189, 5999577, 66383017, 994693, 52171212, 12283827 },
+        },
+        {
+            { 8888927, 29620084, 43900353, 11198961, 41014469, 27998901, 36411207, 7752897, 4539597, 2184177 },
+            { 51749074, 27867377, 61448898, 25674144, 21858546, 32020939, 61445347, 22336221, 62547595, 16071222 },
+            { 32353561, 15216981, 62704701, 32998721, 9622735, 29009400, 58856513, 30517102, 59345479, 27147786 },
+        },
+        {
+            { 58152598, 7753749, 37446593, 14804682, 62604441, 12378479, 47584656, 20881235, 34508040, 4062683 },
+            { 42994772, 4670197, 13030953, 23390361, 13952456, 20327369, 9718021, 20703671, 65693878, 20312903 },
+            { 8761356, 8057205, 40675035, 9905517, 42558866, 1154253, 46809185, 28047404, 9537248, 18137485 },
+        },
+        {
+            { 50799761, 17120010, 46887636, 605501, 7260294, 9063152, 2403511, 13364645, 13423223, 26726082 },
+            { 47054621, 24391785, 41276059, 11485712, 22535108, 19910506, 28295884, 3009938, 55878527, 1702787 },
+            { 26739191, 11009990, 48627094, 16585991, 41212020, 33369929, 9343418, 33309886, 42008080, 4797375 },
+        },
+        {
+            { 28402825, 3806924, 25125539, 29285256, 37661554, 21684793, 6224464, 1582902, 44368850, 1561391 },
+            { 26079829, 10174068, 7784834, 21537747, 50811335, 29965151, 43923961, 13911437, 36585464, 28282522 },
+            { 4277692, 17016752, 6920640, 17844148, 52199379, 25708451, 37177045, 24426410, 34229546, 26319274 },
+        },
+        {
+            { 53995852, 21953996, 31634968, 32542474, 32691621, 19973968, 39179788, 9242992, 66979392, 10712362 },
+            { 448786, 5297823, 6384904, 17684988, 52971760, 30139000, 29201368, 580246, 5011189, 7722222 },
+            { 13344580, 2986769, 62386104, 23534738, 6459270, 17061828, 1721110, 19255110, 58237128, 19998255 },
+        },
+    },
+    {
+        {
+            { 6083227, 12395507, 47067814, 32841329, 11444550, 17967425, 23416872, 10372699, 26431488, 18757223 },
+            { 15803991, 22897127, 29704097, 10955216, 60866494, 29051879, 39057453, 18110854, 53104835, 2921541 },
+            { 12255936, 11948580, 35824555, 25720338, 21202978, 15865602, 17908903, 16823373, 54768932, 20391052 },
+        },
+        {
+            { 57428341, 16317180, 2402138, 19512369, 56456342, 2467094, 30023376, 17366286, 55329052, 28242418 },
+            { 58754742, 10686467, 28908656, 29146360, 16637851, 32779444, 57612326, 15765470, 63662781, 21599717 },
+            { 10816854, 31929461, 24102797, 29243381, 47747329, 25204526, 14656538, 27225599, 3879722, 56674 },
+        },
+        {
+            { 7719324, 16458075, 60725553, 1817, 59835923, 9467444, 62246365, 20635980, 56041271, 26900658 },
+            { 13306176, 7123786, 10035200, 17004769, 26209606, 14010929, 46352622, 13375157, 64537680, 27037238 },
+            { 10212104, 5954793, 39049570, 22617235, 617141, 22403505, 10452255, 24589967, 34866808, 30049301 },
+        },
+        {
+            { 48563638, 21643896, 38142385, 22937928, 40053218, 28386087, 61519060, 23654141, 62395449, 32628261 },
+            { 13182109, 27282119, 65737814, 24185096, 25827771, 32575182, 48421934, 29361558, 27141690, 957129 },
+            { 36904117, 7174327, 8658488, 7385061, 23756150, 31011505, 35420349, 14480372, 50447892, 11067503 },
+        },
+        {
+            { 20190831, 3116205, 35299064, 18927227, 10459945, 22521689, 50064340, 5591657, 31112684, 22807832 },
+            { 63443393, 15081075, 11335059, 637623, 36566182, 7400956, 19345470, 1493531, 49841216, 24572568 },
+            { 9526309, 30527499, 42026380, 20994153, 7304006, 28589919, 50388611, 4737994, 33903514, 9787091 },
+        },
+        {
+            { 65299412, 2541409, 7581448, 14053339, 45430437, 19241884, 3906474, 1408389, 43790627, 27729947 },
+            { 48091670, 2610329, 34147832, 20858651, 57906562, 14639869, 46780113, 3300748, 41833197, 32119403 },
+            { 12271394, 4021509, 26283881, 19232486, 27467579, 32342206, 63549628, 25787813, 8779643, 9919534 },
+        },
+        {
+            { 52094164, 23546478, 43881224, 3788746, 22734611, 10177342, 60947297, 15814756, 41519976, 8890936 },
+            { 36435166, 7403101, 50685994, 16333358, 2161933, 19127765, 61675270, 23364910, 36084317, 5126377 },
+            { 39484316, 29175066, 34361591, 14351886, 55092852, 20059720, 4983918, 503880, 52320814, 24210170 },
+        },
+        {
+            { 50766387, 24754052, 30990425, 17861500, 32336202, 18234203, 54590048, 13139000, 6688050, 9467092 },
+            { 54275547, 9092397, 12690062, 16437288, 49355825, 25276462, 35608082, 26337298, 61994137, 3738924 },
+            { 45896391, 17830723, 37662076, 31296828, 45684876, 6140971, 34309993, 13796701, 23487581, 7747574 },
+        },
+    },
+    {
+        {
+            { 36521780, 28924647, 47099748, 22810160, 51584076, 10280575, 38441718, 7716331, 24015220, 15147052 },
+            { 61462167, 20284667, 53161823, 18931763, 3346794, 33217174, 66093664, 7124141, 4664896, 15322844 },
+            { 58879080, 5997382, 8085987, 17976071, 64782275, 28787564, 25901073, 5262370, 25656743, 3392425 },
+        },
+        {
+            { 61248602, 11777294, 769126, 17777678, 58207309, 6810939, 34047151, 28025690, 28019811, 24552115 },
+            { 30723261, 18884919, 62104365, 15511446, 9149397, 14075675, 52028320, 8780011, 60601280, 32429129 },
+            { 40899999, 26841742, 29530262, 7885954, 30958908, 617491, 10886354, 27112620, 17398270, 28525565 },
+        },
+        {
+            { 4956558, 20885356, 60747773, 31579885, 54784495, 24777500, 44316418, 21771395, 18817571, 26241294 },
+            { 54798508, 1702371, 45905948, 25505929, 5377386, 403765, 42629532, 9674307, 9302088, 26100371 },
+            { 33990875, 28202665, 12466360, 16089921, 38088190, 16555775, 26195362, 27231566, 5646085, 12810190 },
+        },
+        {
+            { 12375340, 29142874, 31344247, 25381441, 51980142, 30087918, 58132000, 16561846, 40902954, 24159540 },
+            { 29358073, 24311476, 48425415, 1114914, 52708922, 18390358, 40328711, 13440857, 43861095, 7151755 },
+            { 22427521, 25337801, 53155174, 5390459, 9717898, 18134243, 42111920, 29710571, 39688047, 8959576 },
+        },
+        {
+            { 36982661, 19898242, 25625074, 6569873, 61652650, 14774031, 15970087, 29184924, 21072392, 17799481 },
+            { 57847009, 6283628, 65209230, 21639621, 33967161, 29395800, 39223989, 33457267, 29917071, 2936988 },
+            { 37080675, 24679558, 5361706, 7325840, 49823797, 25025772, 392274, 14456831, 9885372, 22859959 },
+        },
+        {
+            { 40926198, 15674823, 15490680, 6526093, 13923950, 14064179, 1521517, 1040394, 32631944, 21544264 },
+            { 13523352, 29104498, 22306301, 8760927, 50072148, 12043352, 38830864, 17478028, 52632612, 13913406 },
+            { 27496491, 17289662, 58295525, 29149995, 52719246, 25828366, 10852391, 3110348, 24164752, 32240299 },
+        },
+        {
+            { 58993515, 5274427, 14202128, 3980639, 22519493, 24662014, 38259585, 1503630, 58391760, 23937671 },
+            { 12107329, 24859945, 6010955, 17358215, 37794895, 31992498, 35199462, 16345150, 39598766, 4331498 },
+            { 20321045, 17029564, 8205168, 1278080, 6363273, 10637440, 44236146, 6556861, 60030375, 2662792 },
+        },
+        {
+            { 46898455, 27057883, 22819521, 4633575, 65784101, 22944649, 64281194, 20801276, 63653573, 24304732 },
+            { 8174749, 12907021, 7366869, 10800649, 14755747, 30821065, 18391107, 31254941, 55253545, 8180996 },
+            { 45591536, 7971552, 49752401, 20766005, 63992676, 26052463, 56690800, 20497116, 16249264, 32682860 },
+        },
+    },
+    {
+        {
+            { 10346580, 33077792, 56245969, 22340629, 59699237, 11386693, 27912709, 11780332, 56486425, 32402558 },
+            { 52740329, 11729808, 58129403, 4324522, 1380618, 3235999, 64312437, 27261918, 6562439, 27442076 },
+            { 7457804, 20069469, 5733891, 29015172, 39096504, 31746911, 61884905, 12543214, 27429848, 11816789 },
+        },
+        {
+            { 49183314, 6763422, 22706144, 28779175, 44268362, 27835161, 13600195, 14354316, 24469649, 14182103 },
+            { 53852378, 24412566, 24575832, 13904658, 44263978, 18992399, 23414942, 27990426, 48807824, 28183815 },
+            { 42124466, 8166080, 32884399, 26377599, 26433099, 13158336, 49724820, 18544377, 45553466, 27937261 },
+        },
+        {
+            { 47089899, 1057167, 1151406, 21759862, 63147038, 24678362, 19411078, 15840644, 37986516, 1422922 },
+            { 7226966, 23892966, 34300909, 24547144, 4228864, 12624757, 60817302, 11689759, 59534466, 7645615 },
+            { 4040097, 23619007, 64619360, 1187244, 31415971, 30505240, 18788683, 8315099, 21959221, 26996434 },
+        },
+        {
+            { 19073494, 29517244, 44514010, 3100190, 57666702, 22357009, 50419835, 29460698, 5601347, 10233900 },
+            { 6033336, 9711222, 19885731, 19684984, 54968176, 17410409, 55792065, 13313506, 32398080, 5470206 },
+            { 59124684, 29462569, 25152575, 13826189, 34024194, 30485179, 63013418, 17723912, 35210670, 6722295 },
+        },
+        {
+            { 7783583, 29521840, 41863192, 26474994, 26603499, 10502852, 51484918, 31492108, 8907597, 5426645 },
+            { 10887178, 29998408, 23008115, 1996959, 26345745, 3272147, 28549059, 28848460, 34729273, 30076659 },
+            { 57072711, 21964074, 28169680, 32963505, 61704400, 28506065, 50793527, 7298577, 2556075, 20720752 },
+        },
+        {
+            { 28500543, 21525296, 44388159, 666095, 19635978, 22104171, 60253416, 10918146, 4448423, 27439013 },
+            { 1659386, 1696246, 15694894, 7705734, 42215602, 14051187, 1560607, 23764199, 51428548, 2700817 },
+            { 58924491, 11645185, 35765058, 12217058, 3573955, 30672097, 11112245, 1960278, 40619844, 17046213 },
+        },
+        {
+            { 31780082, 24327502, 56013968, 23603885, 23760846, 25032749, 52042953, 17293963, 31531330, 4776660 },
+            { 13776488, 22974599, 48210012, 15234423, 19621869, 19154048, 53711832, 6697641, 30566815, 33416382 },
+            { 64280868, 1762455, 16884081, 30519605, 25313725, 25869586, 28564060, 10091930, 52293428, 10607354 },
+        },
+        {
+            { 42632696, 19713230, 61545138, 5192811, 20614618, 9319711, 63939247, 24546935, 19645470, 22290271 },
+            { 51660433, 20598104, 8297360, 17215737, 26001314, 11118805, 20972297, 18508181, 60877201, 19130223 },
+            { 26571516, 13254858, 35505053, 18130966, 32650026, 30205563, 64100872, 3994167, 26626691, 22941984 },
+        },
+    },
+    {
+        {
+            { 39100484, 2647814, 66551544, 19119596, 19427704, 15870322, 31787181, 29471964, 22278889, 6317806 },
+            { 53441576, 11157204, 5128927, 16921895, 57626810, 27174016, 62037445, 31484518, 52574579, 16881233 },
+            { 33828484, 32431703, 48400689, 13874373, 32782178, 33448597, 25547283, 10785151, 41030144, 14346763 },
+        },
+        {
+            { 52907733, 27738773, 23263514, 26412034, 18278912, 5627820, 40699921, 6765543, 36860059, 31410308 },
+            { 38136897, 28503504, 14867137, 15835556, 66482082, 2262238, 33914738, 28743972, 9241905, 17943513 },
+            { 11375832, 10181657, 5007665, 32298929, 43439907, 29442548, 7766690, 11637141, 3564243, 11636475 },
+        },
+        {
+            { 25622719, 6475425, 48108362, 28728716, 41655403, 3693810, 51573585, 18494784, 57531772, 7842949 },
+            { 41449813, 25387770, 3600380, 32878496, 48721989, 20274382, 65031436, 31191608, 56181803, 9020603 },
+            { 6737772, 16017032, 60485804, 6450787, 16805878, 17665890, 55795558, 777006, 54142859, 27213661 },
+        },
+        {
+            { 38688874, 32137558, 24102315, 19025397, 26731486, 1913811, 61271801, 29218112, 52542649, 6386409 },
+            { 54453365, 17596091, 62017981, 5566743, 40333310, 2542257, 42511527, 1518117, 32425009, 3373400 },
+            { 14928705, 27748605, 49271408, 27920316, 50073163, 4602755, 16940648, 31301708, 57274054, 16458857 },
+        },
+        {
+            { 10698799, 21753324, 43319797, 6282063, 18449787, 33090214, 48129122, 18013928, 60074318, 32079521 },
+            { 58812077, 25024253, 49669075, 29841510, 20444832, 32176520, 1535072, 27236160, 65085235, 5241708 },
+            { 63793057, 23325316, 44231250, 810717, 39418754, 8930739, 46585111, 22143708, 64309661, 14021861 },
+        },
+        {
+            { 21756920, 23801094, 5449987, 26072876, 20307855, 18051744, 36738878, 20718558, 65474550, 15349273 },
+            { 12242540, 31987692, 54772695, 6350204, 52744584, 25343514, 59662862, 33397134, 44719988, 11948677 },
+            { 28309848, 3364693, 48508395, 14920371, 48822953, 23405181, 9555144, 7065272, 3944235, 27719757 },
+        },
+        {
+            { 4951523, 15690522, 14880855, 8519248, 42717983, 9874088, 63536624, 7259759, 12989831, 8402230 },
+            { 26724650, 4675512, 36954561, 16337448, 20792326, 3467676, 54320376, 13812358, 48550476, 32907332 },
+            { 9679659, 12276434, 53249041, 32895693, 16510920, 27649287, 24074349, 28482284, 23600089, 27623919 },
+        },
+        {
+            { 52668674, 30340388, 30041967, 11753827, 32540373, 7885479, 21494429, 29367479, 39336172, 10678750 },
+            { 14556385, 25199642, 58982103, 20477669, 61035619, 22349221, 67037197, 33168509, 20790979, 14145741 },
+            { 39682102, 10365496, 43125879, 303513, 26055800, 9233714, 1544212, 10783003, 61041495, 15255215 },
+        },
+    },
+    {
+        {
+            { 13709424, 28243787, 30658613, 19907280, 39368972, 14679755, 29939045, 1891282, 27601955, 21782015 },
+            { 6456676, 26383748, 65440547, 31802790, 11087585, 27496003, 18004339, 9296837, 27258448, 15922863 },
+            { 12181113, 19251604, 45315319, 31332365, 16009887, 23782284, 43463785, 20676684, 3515929, 31939814 },
+        },
+        {
+            { 22615863, 7758979, 26919993, 9915811, 40872199, 25804746, 54661126, 33496129, 21424869, 31942270 },
+            { 20038077, 22248848, 50617126, 17577826, 30802514, 5895106, 41355634, 5261452, 38580531, 28329971 },
+            { 6763013, 13765978, 53321263, 21095766, 14809003, 16769926, 37289643, 11742262, 22770778, 12963910 },
+        },
+        {
+            { 50503751, 3054094, 47776511, 12056445, 21005442, 22465506, 30273802, 2846210, 34724233, 8452370 },
+            { 58340875, 4219949, 14703898, 17091759, 40297996, 149418, 66059389, 22083497, 5115190, 10341261 },
+            { 62514079, 26193549, 54819536, 21729754, 4288261, 6031202, 62008531, 18514441, 43365587, 22668612 },
+        },
+        {
+            { 21711231, 17542339, 26271972, 3526118, 8119692, 1142597, 42244716, 23103218, 35656709, 1382965 },
+            { 50558244, 32866692, 5065323, 28674014, 59261623, 32084142, 42290577, 25114001, 9270013, 18645300 },
+            { 20080606, 22637182, 30490654, 7210668, 54214494, 18408078, 49376889, 6968386, 18462259, 18245562 },
+        },
+        {
+            { 35317113, 18569953, 20682126, 8893813, 13020185, 2452812, 45287584, 12305539, 5493274, 12394874 },
+            { 14739307, 8925852, 34773624, 13063417, 46444457, 19337858, 49243233, 329001, 35265821, 3200231 },
+            { 537587, 30482663, 9471570, 33461598, 29333653, 20285463, 65585317, 20417124, 5805054, 26592406 },
+        },
+        {
+            { 50916927, 10995445, 16388152, 2978592, 58142056, 10742695, 56683497, 17183477, 27860304, 5652808 },
+            { 44437857, 781772, 1381250, 15312553, 59914307, 26906998, 36809271, 50891, 12601078, 13360121 },
+            { 59837132, 15222705, 16107540, 29854569, 37769087, 28415444, 59796565, 9200466, 5434008, 7268345 },
+        },
+        {
+            { 3568764, 26944883, 6404587, 10180702, 10815493, 7961328, 23281271, 7940263, 53651643, 24820138 },
+            { 64311198, 7754796, 41434426, 32964713, 11894386, 5228204, 23276368, 26815032, 48480715, 26673735 },
+            { 15800554, 14255173, 60141072, 31236516, 11329249, 15310656, 33197658, 13831758, 25312629, 31623845 },
+        },
+        {
+            { 49820167, 9375895, 43431582, 10374473, 45081171, 33392631, 4589980, 2497038, 17920358, 6412770 },
+            { 9185998, 1882711, 59339862, 11741428, 27738098, 15184939, 21462049, 30828678, 1190573, 24602203 },
+            { 51138684, 14138393, 41415243, 1427937, 33976097, 14483519, 9915704, 26116623, 61268621, 23508269 },
+        },
+    },
+    {
+        {
+            { 30624416, 20428190, 41155279, 418413, 53489275, 22878479, 47328113, 33420454, 45048310, 12064615 },
+            { 56909861, 9477006, 10089317, 8504039, 13126086, 23980613, 41935214, 30323787, 17558157, 1638976 },
+            { 35384153, 31721141, 16865416, 31928036, 26770534, 30042151, 2769243, 31769741, 13565447, 10809822 },
+        },
+        {
+            { 18870784, 31815080, 45687512, 18188992, 53330755, 22255029, 21598285, 23720254, 16981575, 21160715 },
+            { 50761878, 2595841, 3223760, 11478824, 44785004, 1704263, 28019409, 28033278, 51456021, 1187791 },
+            { 42617186, 21168641, 26429702, 10127433, 29357889, 24103133, 61318487, 11625205, 55823802, 19666254 },
+        },
+        {
+            { 63001300, 21513929, 46610400, 5105879, 24840609, 7318424, 26629447, 17304513, 30739408, 1389103 },
+            { 53673849, 25112454, 32732044, 16260520, 61724586, 517638, 43333174, 18947997, 22353687, 13910451 },
+            { 30345021, 2902983, 5162772, 18726837, 19759778, 20991898, 47583977, 4538330, 31805532, 30122165 },
+        },
+        {
+            { 24583426, 7569242, 36683803, 7038943, 17041883, 11611847, 43529742, 17574280, 23229696, 10575612 },
+            { 14173384, 14311420, 23670113, 15125454, 49040353, 31067935, 44098400, 4340308, 43355367, 32370832 },
+            { 16869534, 6557632, 33600484, 10353712, 56485759, 32182043, 24588190, 1741860, 11830688, 21247969 },
+        },
+        {
+            { 51036510, 15868401, 48645270, 12573709, 46386837, 24693787, 40835058, 32625509, 7355220, 20176820 },
+            { 41394682, 5041892, 38204584, 18029768, 30650605, 30601562, 36335130, 21447495, 5130283, 11850181 },
+            { 16510479, 18815334, 63286650, 18176685, 41491663, 7737541, 33231369, 22315538, 44894750, 20453257 },
+        },
+        {
+            { 26207936, 15850744, 38576902, 14065219, 59707844, 18264707, 43919232, 28772223, 32197844, 6641181 },
+            { 55779104, 14342290, 56064851, 7584388, 17459672, 2345856, 16421236, 32529277, 23625928, 25574497 },
+            { 37328793, 28812227, 3083700, 19007469, 32200810, 3498973, 40634415, 1431141, 48410164, 5757690 },
+        },
+        {
+            { 38134293, 8642276, 28800851, 24038496, 63807876, 2142240, 41051641, 31147472, 43396496, 28222655 },
+            { 32258658, 15909644, 41439429, 2656711, 33831085, 31113892, 56777756, 5254929, 41607849, 10739105 },
+            { 8708778, 25057622, 11839433, 14605987, 49646575, 32105764, 11949318, 8059627, 13314843, 28967179 },
+        },
+        {
+            { 38936446, 1658245, 62341798, 29667585, 26752026, 6228089, 12901930, 16123303, 49778365, 19745806 },
+            { 36227694, 21957235, 19381793, 517552, 48975125, 15347007, 20409297, 18300136, 15007529, 2276981 },
+            { 45923816, 2732271, 30486111, 5693908, 20725545, 29351802, 15365219, 30862837, 41530916, 3620021 },
+        },
+    },
+    {
+        {
+            { 59538419, 33030040, 20097619, 16893018, 58502777, 28115529, 64595853, 10337284, 10198951, 32449727 },
+            { 60128228, 18137341, 2662803, 17237038, 42929256, 8716368, 17742056, 5985806, 15380671, 2812132 },
+            { 1759737, 33278880, 55006194, 10734974, 34448885, 22637392, 56229854, 18619680, 58577915, 629932 },
+        },
+        {
+            { 25995253, 15321678, 20676051, 19649090, 61764248, 12928225, 26535743, 5834045, 32469870, 9220744 },
+            { 34112996, 11707081, 25397526, 23336346, 43033007, 32870260, 51188491, 5550703, 12235466, 30438527 },
+            { 20957975, 5279561, 23238636, 22532559, 2228467, 5359535, 50425804, 2719280, 33857076, 1049550 },
+        },
+        {
+            { 7240454, 15271080, 11273695, 2712681, 5348885, 8032711, 59373035, 29260786, 7428074, 13241387 },
+            { 39961947, 25238958, 48420217, 12461724, 14323547, 14167305, 19720948, 14642646, 43535733, 3294683 },
+            { 53963240, 695981, 29721039, 29601164, 1212789, 30206689, 19469173, 17040682, 3686074, 3532094 },
+        },
+        {
+            { 61006252, 18037225, 51834748, 33019533, 17071972, 23035035, 38857606, 23249638, 36901501, 3511880 },
+            { 34936564, 24998631, 29933542, 8070229, 62521711, 20618995, 60691932, 14179866, 52562218, 2485295 },
+            { 27907891, 15385928, 56932497, 22458581, 43715499, 13320965, 37097059, 21818443, 44646067, 33498175 },
+        },
+        {
+            { 8172093, 33008999, 645284, 21666114, 39145029, 13577338, 29966526, 21117640, 46103951, 28550646 },
+            { 56383782, 3964807, 25067649, 15849772, 6962365, 29824617, 11063678, 15714325, 20748469, 26633146 },
+            { 49792143, 23738691, 10896566, 9140583, 61702352, 20833591, 61389298, 23099580, 34128171, 30164606 },
+        },
+        {
+            { 32798541, 24007496, 48557832, 23315645, 50170821, 5657131, 2875422, 4345059, 19486241, 15948449 },
+            { 66168011, 304404, 49348006, 5130153, 49518727, 12511161, 26577308, 5349209, 11135620, 12621286 },
+            { 49064345, 20423822, 2484221, 202566, 49719660, 9997022, 13565515, 445687, 42280545, 16599808 },
+        },
+        {
+            { 46405318, 3139195, 47067723, 12406423, 45230400, 14591147, 44357003, 11349074, 29986961, 1524641 },
+            { 34820550, 11084682, 41615357, 10998778, 10586397, 25353713, 30732986, 25895275, 12216682, 25362497 },
+            { 43826839, 24643639, 32407715, 11905118, 65544177, 17948517, 41308039, 29992689, 43694445, 14292209 },
+        },
+        {
+            { 46524350, 15739966, 60278918, 2777158, 29961914, 9932699, 19292707, 33103422, 47589413, 19409917 },
+            { 15964973, 7223198, 54363867, 26034749, 33360821, 29179870, 40430396, 30237827, 46739388, 27902271 },
+            { 17388289, 33482648, 39787810, 10491140, 50596734, 6691083, 15825661, 29816801, 65932751, 27280422 },
+        },
+    },
+    {
+        {
+            { 5874757, 7110952, 27386301, 22173885, 59077330, 24757591, 32909583, 17005623, 60622608, 10014662 },
+            { 30546551, 30841985, 43682402, 18259401, 46334224, 22932188, 16328174, 32609723, 40497423, 1916187 },
+            { 25925904, 13655488, 2627647, 14901375, 43755651, 22333183, 16380833, 1006284, 40835636, 24849867 },
+        },
+        {
+            { 15231383, 12075450, 40927197, 33343108, 39947469, 453615, 2361173, 5902990, 26037340, 929186 },
+            { 39451470, 23643848, 10876066, 12148310, 2458574, 20206795, 43513414, 212406, 34359148, 14727324 },
+            { 47075494, 7423842, 19471986, 30241129, 12913474, 19188352, 44895551, 30743401, 11899472, 8829674 },
+        },
+        {
+            { 556835, 21856316, 49318512, 30331882, 19994721, 2058336, 25292634, 18722142, 6039489, 2682971 },
+            { 54547760, 5164339, 22996126, 5380164, 15799209, 435330, 48401280, 17673146, 59281584, 4602595 },
+            { 9731901, 19334643, 38757116, 20272654, 53681078, 15765078, 4810584, 7175148, 35833468, 19146447 },
+        },
+        {
+            { 7337550, 5873052, 10988340, 15232053, 4384079, 6032278, 7402343, 26020617, 40970112, 11939299 },
+            { 66989705, 18971288, 39687059, 8942752, 49835710, 16514683, 30754115, 23957999, 33487208, 4113918 },
+            { 63148075, 24218539, 15011642, 9719616, 31254661, 16851129, 24322160, 21870705, 51884721, 2537613 },
+        },
+        {
+            { 20099536, 14936171, 23364117, 14619580, 61256628, 20834575, 45473819, 20108560, 31316563, 26987895 },
+            { 38602812, 8800915, 3299181, 18350415, 13808513, 16431851, 36515029, 22385412, 28158335, 28733994 },
+            { 10056483, 23510729, 61200975, 33011584, 7266177, 19844223, 61052666, 28902772, 16140025, 788077 },
+        },
+        {
+            { 45341803, 7111993, 32290273, 28142569, 16635342, 664496, 15516680, 12515843, 39368131, 14986638 },
+            { 39011789, 6401365, 36520084, 8775200, 62627224, 16460357, 37345852, 10636563, 66475671, 14808879 },
+            { 508421, 15431463, 7325714, 11512214, 51746552, 25378858, 32931466, 6671483, 11465440, 25544877 },
+        },
+        {
+            { 30084668, 2004320, 19741398, 3590690, 10764224, 14473759, 374027, 30089485, 58040429, 22389578 },
+            { 12404655, 11190203, 6365186, 30992035, 22448539, 23578412, 32879620, 8732224, 5022657, 15043813 },
+            { 53989345, 19800838, 52326817, 18360768, 1497750, 25680217, 14549595, 32284253, 38383063, 28290692 },
+        },
+        {
+            { 66430267, 20655696, 29248391, 15218180, 41100952, 25777223, 20041026, 33208823, 42000137, 23728491 },
+            { 28422467, 25171753, 28591008, 29621902, 28651950, 33357799, 46873385, 30715358, 42736865, 2486439 },
+            { 32216266, 6254487, 59312541, 29647748, 14893712, 23711895, 57109072, 16283783, 67075672, 2640167 },
+        },
+    },
+    {
+        {
+            { 7184873, 17670367, 62374868, 24706509, 65472038, 6148437, 65127, 30033414, 32228731, 10657574 },
+            { 18746698, 22078260, 39915799, 6954599, 12791172, 26442700, 17243080, 4299795, 28465943, 18179149 },
+            { 13737629, 23389818, 8386335, 6074657, 37881415, 29835939, 10775459, 9999959, 40730548, 14666952 },
+        },
+        {
+            { 2208029, 4805874, 3925618, 1183512, 26981643, 4334333, 65407112, 13754573, 1841441, 12708077 },
+            { 23031304, 27384301, 54542773, 26925313, 19467982, 11504761, 19740480, 16022638, 18286074, 4057599 },
+            { 45440224, 14107099, 38490589, 33378412, 12522714, 11978472, 12683246, 32135120, 5777338, 22393281 },
+        },
+        {
+            { 66339846, 14942346, 44472105, 33029253, 45043853, 16280890, 5550205, 31223488, 28058402, 12392111 },
+            { 48879799, 13917376, 43848133, 21570616, 59741321, 11100341, 64928678, 28653481, 27025098, 29175046 },
+            { 15698538, 30557362, 30133301, 32645083, 60178067, 30681039, 65416887, 4028085, 42066401, 27872844 },
+        },
+        {
+            { 9716687, 29441925, 62579199, 13382374, 21965595, 18796983, 2982313, 7579175, 63622416, 23141001 },
+            { 30535305, 9719401, 19996283, 31980699, 33887509, 14780612, 18347648, 21473260, 22919349, 4015328 },
+            { 45123351, 24341255, 20417022, 11306903, 27239114, 24836761, 10333969, 18237569, 47739019, 3474735 },
+        },
+        {
+            { 21678568, 1746058, 16240689, 3058346, 9197741, 24205699, 64889345, 8401561, 28390588, 21212735 },
+            { 17724918, 27302271, 14744054, 21355655, 59862264, 33107066, 22310735, 6008392, 1651488, 27356360 },
+            { 45297869, 30388661, 33437718, 3709309, 34836768, 10870497, 28944738, 5918309, 52078541, 24506867 },
+        },
+        {
+            { 57910626, 4214694, 14427770, 12207969, 38368189, 21397592, 41093742, 8852735, 21096874, 31638507 },
+            { 38449058, 13742046, 42087911, 23226886, 48110615, 8132067, 59127141, 27894313, 44733577, 16570686 },
+            { 17151112, 27855995, 59758570, 23388746, 43306905, 32728346, 43374531, 25591052, 367974, 591360 },
+        },
+        {
+            { 54061569, 21176179, 56018182, 365707, 32617327, 24150775, 65527618, 3937692, 45755802, 20226326 },
+            { 58350564, 1965992, 30865878, 1518895, 57512124, 17985720, 57172643, 5478492, 22253125, 18728665 },
+            { 7368926, 14678033, 50067306, 1797802, 53386513, 56267, 47293339, 16718454, 40869885, 19639023 },
+        },
+        {
+            { 11127026, 5058353, 29814084, 14964337, 66053108, 17932474, 24216140, 24363009, 35044489, 1161449 },
+            { 14219148, 288656, 29501638, 2745224, 41970287, 17882489, 43356868, 10266893, 54374450, 7975198 },
+            { 3737278, 26546364, 63259292, 10951445, 19400309, 29503687, 40891974, 12815641, 66778808, 32763384 },
+        },
+    },
+    {
+        {
+            { 32848944, 14869187, 34804399, 5534471, 11039196, 5740254, 64174106, 24721272, 27856025, 9081406 },
+            { 54459260, 4231154, 22186379, 13513185, 28360494, 29876356, 13136225, 10172232, 48910727, 3756406 },
+            { 20950104, 24131363, 25144687, 23541537, 22175541, 54021, 62819834, 2542213, 66078937, 17131473 },
+        },
+        {
+            { 64112697, 21326382, 23768720, 4029825, 31214093, 27435391, 18178852, 1976855, 18066803, 1578133 },
+            { 31661618, 22643214, 63570965, 11280429, 65042543, 14335081, 52439930, 19840768, 21817115, 5458167 },
+            { 44203906, 6521442, 33857095, 31214861, 28698122, 21877324, 10502672, 3702605, 49951280, 29797977 },
+        },
+        {
+            { 41982293, 2261440, 7484961, 22043166, 17746383, 427757, 28563327, 10336595, 66597727, 25263026 },
+            { 32310012, 16136403, 5588409, 23251833, 4540367, 207066, 19571111, 23353236, 65610769, 14015038 },
+            { 3408945, 170331, 59109476, 20739884, 41891269, 19926922, 36741048, 6237882, 49680212, 32130238 },
+        },
+        {
+            { 36525463, 30663550, 39945383, 172984, 9933425, 23793922, 2716364, 25772056, 48446390, 13577817 },
+            { 47979075, 18225047, 15177280, 24298686, 41695323, 7358524, 23090983, 20433776, 14859743, 25765980 },
+            { 51472649, 655647, 9235246, 14742194, 34220816, 2192263, 12508915, 7376392, 49265348, 29907102 },
+        },
+        {
+            { 17510178, 2486032, 17342374, 20819581, 63340918, 22530676, 5050103, 18893861, 26982433, 9534086 },
+            { 53915093, 979169, 36049658, 25045397, 12341386, 16890820, 54854328, 32827220, 58619129, 20074931 },
+            { 13924344, 19503710, 66860507, 31541387, 6447848, 834904, 33341881, 6961646, 40602454, 27224139 },
+        },
+        {
+            { 46674060, 29160675, 43345263, 23301980, 34226015, 17181373, 35494754, 2633743, 58923668, 3332402 },
+            { 12414471, 33055213, 63868428, 1982095, 28982280, 13130288, 55908252, 15815288, 32757594, 30975476 },
+            { 55337848, 4132052, 17573382, 15149583, 48598385, 28493608, 13950828, 28926651, 37697397, 19172602 },
+        },
+        {
+            { 10429595, 6389639, 38956903, 11340057, 20929227, 14634338, 27445773, 10590678, 49627870, 27664381 },
+            { 29359162, 15089315, 42642514, 24029805, 59031444, 15880853, 50917357, 23740023, 14476775, 25832528 },
+            { 58946876, 9457827, 53668092, 31732567, 25976570, 18520105, 28156318, 23444311, 38086783, 1914420 },
+        },
+        {
+            { 14881928, 1929648, 43419907, 26677505, 8802470, 19413861, 31769880, 16723524, 11747879, 13665112 },
+            { 785457, 32928593, 33222758, 17660300, 30045362, 19669104, 5395003, 20435976, 50571060, 18350267 },
+            { 67003895, 9353131, 46767956, 10673923, 31496315, 18236419, 33885975, 7514243, 23570557, 23833145 },
+        },
+    },
+    {
+        {
+            { 61039175, 28502180, 61646513, 18191175, 46022241, 10493065, 62868660, 10782757, 19715924, 22944716 },
+            { 46271806, 11879199, 38565556, 24446539, 51982197, 33518413, 4729184, 22498013, 57848575, 19179291 },
+            { 34865964, 31604722, 64775790, 21111800, 63850560, 18599085, 33787793, 15757666, 12526404, 20055533 },
+        },
+        {
+            { 738436, 15209961, 21522471, 13794043, 48836792, 14800412, 30429911, 25848873, 27832413, 31622476 },
+            { 7453038, 1368394, 37183999, 22742559, 59046526, 20202498, 44870034, 9010655, 50813815, 2678541 },
+            { 47207979, 24927246, 3435927, 25577769, 37436704, 25437415, 32080382, 11402077, 37938668, 30062090 },
+        },
+        {
+            { 50482115, 2417753, 33249389, 23743105, 37332805, 6245161, 24518258, 24682398, 32127820, 1670554 },
+            { 50030070, 27495790, 41166835, 4690836, 15161979, 16163792, 6736582, 30256535, 1522394, 6083038 },
+            { 20110157, 2863573, 58077504, 19013400, 48342675, 27784469, 63089001, 25233729, 63112151, 6731693 },
+        },
+        {
+            { 63117204, 24026960, 10802080, 33331601, 9552675, 1668152, 32465931, 23752804, 25695593, 10570178 },
+            { 65722787, 3332180, 7198948, 33196379, 22465317, 168113, 28159978, 31217212, 51623216, 12543795 },
+            { 66557624, 22140625, 32145655, 10133860, 55254720, 19200126, 43121181, 3851703, 24621200, 26560191 },
+        },
+        {
+            { 30788012, 9648360, 9186580, 32016379, 49143436, 30611054, 57090578, 4678128, 9767830, 22626800 },
+            { 11190911, 28224469, 54855848, 23434530, 64739775, 2871272, 42839467, 17558277, 54075639, 18007183 },
+            { 24198755, 29109748, 59671104, 13151703, 13959055, 14276941, 41274245, 22700841, 63937795, 25946997 },
+        },
+        {
+            { 63849876, 32446585, 13617050, 21872361, 53849302, 23523111, 5628961, 14824464, 49650809, 29040401 },
+            { 26779764, 23437013, 63224022, 7631433, 24902215, 19400840, 60170916, 1596054, 10102388, 8633413 },
+            { 50964642, 32200923, 63940064, 7414018, 35282843, 3514681, 58589943, 18020373, 25911197, 5742629 },
+        },
+        {
+            { 61891012, 8080726, 14682554, 24944864, 17526835, 25572366, 3072254, 8940582, 19981658, 22727474 },
+            { 4072283, 24895299, 31253684, 33419418, 28370693, 29737767, 40933910, 31930606, 59318305, 544082 },
+            { 46122402, 31943081, 7152574, 27590386, 773769, 27496615, 32307558, 7108196, 62420813, 32473617 },
+        },
+        {
+            { 50854417, 29191124, 22954636, 32467808, 33947441, 27567099, 49424225, 27353421, 56346919, 30415953 },
+            { 54482371, 7542434, 39063955, 19529462, 1591132, 11995702, 13303707, 12795301, 21854370, 8234601 },
+            { 65530506, 10796252, 54934766, 9852962, 10851551, 19353566, 3317609, 19710842, 4680658, 12478641 },
+        },
+    },
+    {
+        {
+            { 22514622, 24411983, 2166949, 26614083, 11376441, 13509235, 33815157, 23596209, 5161866, 2412512 },
+            { 61225711, 12235212, 11132467, 15344146, 11665129, 26600513, 4018211, 2010037, 35278347, 17088839 },
+            { 21587062, 14311011, 24712437, 16246189, 33851051, 22254706, 34174909, 10704059, 6677587, 2094364 },
+        },
+        {
+            { 48818115, 8672614, 5547528, 21799492, 63571656, 25317604, 30807835, 18780482, 9784228, 338920 },
+            { 26029005, 986953, 48757003, 7174917, 6031977, 23738241, 65334048, 23363393, 61049663, 7371134 },
+            { 62088812, 6668294, 26687846, 9592831, 13369729, 8921916, 59296909, 7111974, 56874221, 10773008 },
+        },
+        {
+            { 1750763, 21885167, 4726643, 10119869, 718929, 10871286, 60427004, 3219098, 50384072, 23434192 },
+            { 4959226, 18481527, 26746983, 15903927, 11556605, 26942779, 58921562, 30974840, 17439216, 16480865 },
+            { 17393664, 8963403, 20110473, 13337651, 24126229, 11533166, 47908131, 28392421, 2065775, 22955351 },
+        },
+        {
+            { 1566630, 5953730, 33871550, 18473384, 33698212, 13562369, 21765546, 6858313, 8692869, 21955144 },
+            { 48286191, 9680708, 5436102, 7311888, 18492958, 16085950, 18594642, 19219251, 51964190, 7995123 },
+            { 30126015, 17113212, 43825754, 28543755, 9204918, 10837144, 45820785, 12501359, 25340489, 16405875 },
+        },
+        {
+            { 29047359, 8190936, 52942183, 19494344, 37408769, 12656500, 53962268, 9696955, 23228220, 26555898 },
+            { 47273011, 30726031, 34897041, 22047635, 54646180, 14574471, 32050901, 12494879, 8189001, 5282082 },
+            { 8203499, 20182871, 26688684, 16169406, 34323135, 33140907, 65909096, 28797984, 3883864, 2993835 },
+        },
+        {
+            { 50374971, 11449741, 40789001, 10408892, 49807503, 20625161, 58827569, 8542987, 4786208, 75191 },
+            { 35847832, 25883361, 37089116, 11957700, 18733193, 14943924, 21585529, 10494795, 24661569, 32810240 },
+            { 41837408, 19800944, 10584974, 20211876, 1909072, 903984, 50183583, 23360552, 28588035, 4329724 },
+        },
+        {
+            { 52717723, 31050616, 19937965, 23960741, 55011883, 23646189, 28081992, 4004783, 13948268, 32737563 },
+            { 56784605, 4265293, 60504255, 7256866, 54092886, 20343609, 53389454, 14193246, 48572057, 4545837 },
+            { 58768979, 17572767, 41088798, 5875022, 24965859, 30157612, 11591321, 13509397, 62106031, 29622551 },
+        },
+        {
+            { 27093406, 32643201, 63779847, 17617676, 9290558, 25312747, 52267287, 9033887, 49970952, 7629845 },
+            { 1807851, 5197188, 9490047, 30047098, 65780941, 18212194, 12169159, 28584650, 17140544, 33460166 },
+            { 23852575, 26315897, 5530488, 8614556, 55436972, 20977293, 6471426, 18647467, 36193325, 22645081 },
+        },
+    },
+    {
+        {
+            { 30119711, 23770162, 21311900, 21823146, 4545194, 28285816, 59914250, 20269118, 42213620, 8364850 },
+            { 529615, 24214152, 48763884, 17517848, 34608347, 29930669, 57187474, 12824929, 50238307, 131950 },
+            { 837674, 6366159, 63606356, 1326052, 14882179, 5587264, 40965223, 28191232, 34616361, 1085538 },
+        },
+        {
+            { 8479303, 1252296, 49441565, 28777342, 37145290, 21515653, 12659470, 24834798, 16278314, 2131977 },
+            { 66322271, 24810602, 51859763, 20545046, 40783521, 7257436, 6671327, 23831943, 4813411, 4535646 },
+            { 52161699, 7266074, 40810080, 24000344, 22340861, 28763371, 43255883, 30700065, 14275705, 7033170 },
+        },
+        {
+            { 65666771, 33135427, 52507661, 58051, 44158185, 33130835, 10928134, 4916762, 57441072, 17250657 },
+            { 10111229, 10446862, 48486827, 22336449, 47070866, 14388844, 12258710, 8943835, 29136865, 14105927 },
+            { 40943650, 17756533, 41995061, 8706188, 61577712, 24653786, 6223961, 1200883, 2084980, 26507464 },
+        },
+        {
+            { 50114206, 15280135, 22189231, 24568196, 31096111, 248622, 8877467, 5184062, 31974465, 16934713 },
+            { 53528015, 23142651, 25270983, 11606798, 20140754, 8660652, 7503954, 31292882, 64064532, 2872437 },
+            { 38871529, 6525922, 33293145, 2547665, 32946773, 4394489, 5572331, 32944228, 38978722, 26855945 },
+        },
+        {
+            { 21420835, 2996234, 56030645, 13883689, 7353236, 14501979, 6565171, 22802569, 39650933, 33324800 },
+            { 7063979, 25722166, 33378536, 32684019, 47526382, 28164652, 17961663, 27730159, 37854096, 7001327 },
+            { 27174570, 25609740, 35347229, 4313359, 79392, 3821387, 55905988, 27428730, 40762783, 20375182 },
+        },
+        {
+            { 62356584, 12594930, 50936619, 22318987, 58126865, 2677171, 58742623, 31969182, 29908273, 24347809 },
+            { 27002709, 32280302, 32461212, 23996328, 14096219, 26955971, 51865974, 28585923, 24021300, 14205308 },
+            { 11582952, 27642726, 63661622, 3499318, 32917532, 9069983, 25721928, 4635854, 40828400, 21228298 },
+        },
+        {
+            { 49564092, 13050301, 43754795, 5306453, 21416865, 9327901, 15046741, 13391872, 26496835, 27829069 },
+            { 59248474, 15367382, 16277114, 6739999, 62369812, 32551330, 55316476, 9737490, 45794787, 19305144 },
+            { 10961120, 12893057, 3048727, 32300660, 5293294, 12651584, 47903348, 28012126, 26438364, 32702150 },
+        },
+        {
+            { 3598048, 5152435, 31306191, 18606787, 65530590, 14808292, 63654237, 9422665, 66057716, 7361216 },
+            { 59341101, 7827610, 13407330, 3592841, 7127763, 18155609, 62760551, 8454548, 32616457, 7835919 },
+            { 11031185, 18805829, 41280300, 26247590, 22994354, 27094522, 15573511, 9596005, 25601393, 24891641 },
+        },
+    },
+    {
+        {
+            { 23839512, 31937930, 30191243, 10928297, 40162819, 3795406, 47751084, 3675676, 42812306, 21491884 },
+            { 62729835, 29072573, 65654560, 11568341, 1526211, 21080228, 41886428, 5304747, 41011572, 18024545 },
+            { 31631756, 32785893, 5383025, 17390427, 7420283, 2405746, 7571514, 22596454, 42255604, 28946039 },
+        },
+        {
+            { 831624, 18334782, 2764143, 14858017, 30256467, 15702468, 51401443, 32004182, 46938630, 24982016 },
+            { 52289873, 9958290, 310270, 4131042, 56690435, 7642247, 39445546, 29303978, 26806496, 11838609 },
+            { 17257178, 24263775, 16782188, 29768695, 35681164, 23263715, 42629165, 27859062, 22801424, 26981751 },
+        },
+        {
+            { 63571069, 24965746, 32341525, 6267561, 34016971, 7561107, 17340066, 9542139, 7856640, 8162947 },
+            { 61999261, 2650242, 42094503, 17610342, 33688787, 9949971, 59098678, 31725716, 62926855, 12235746 },
+            { 29103472, 22126329, 41000518, 1076693, 1002340, 16375966, 21844350, 25822442, 53072715, 2163451 },
+        },
+        {
+            { 53994731, 20454111, 26827178, 4173643, 36898174, 22642126, 38131817, 104196, 33949508, 9546750 },
+            { 1094279, 25087351, 39038765, 7005183, 10247599, 28461317, 44168291, 5165031, 35200084, 791510 },
+            { 65295137, 2333246, 33965819, 4589242, 35136981, 21630261, 25819076, 6597075, 46495037, 9871602 },
+        },
+        {
+            { 22197986, 31033934, 13595617, 7358881, 13593976, 655068, 43161067, 1654760, 56381550, 1767491 },
+            { 47715934, 9163323, 31932932, 18504798, 25755396, 2222320, 36570337, 12977090, 33335170, 32718486 },
+            { 36320351, 25520749, 64586578, 11686551, 8918065, 12324350, 20726420, 14922996, 10592750, 24775132 },
+        },
+        {
+            { 36936820, 12190352, 56409344, 20267007, 13655365, 4230318, 53383054, 12437136, 46532028, 11741792 },
+            { 25782876, 9724139, 39765672, 31407210, 60923115, 10706788, 58273737, 2114956, 62109803, 2572604 },
+            { 25017966, 22498630, 66355109, 22306599, 8515771, 5957912, 32271769, 27772098, 24278849, 32033140 },
+        },
+        {
+            { 36308842, 10436703, 19651994, 16298418, 56500642, 26358757, 51214408, 30181972, 51886874, 11083383 },
+            { 23985634, 28208884, 17119750, 12461245, 42472797, 32581223, 40153939, 3150285, 59843484, 20245609 },
+            { 64694032, 29074316, 60077003, 16168481, 6447443, 7438648, 34693833, 30635139, 59392933, 10401108 },
+        },
+        {
+            { 38209404, 10442979, 735595, 17368334, 37150029, 32374220, 51324613, 15968915, 58000305, 2098510 },
+            { 20254049, 28791493, 3597544, 4682921, 54591279, 25588426, 52112649, 20733197, 66578392, 21248609 },
+            { 37671907, 27747522, 14965684, 26110725, 16048571, 27938534, 64400478, 15030530, 22347379, 9370165 },
+        },
+    },
+    {
+        {
+            { 4863441, 14069888, 16285550, 1692464, 13072445, 19453337, 46718946, 10588016, 39803824, 22477416 },
+            { 66814447, 2704019, 1566698, 4841377, 46629076, 11152592, 21433955, 21500789, 35627575, 13143649 },
+            { 64699839, 1487692, 45892000, 31720801, 280269, 25750507, 23803447, 24750354, 51794063, 31210166 },
+        },
+        {
+            { 5271993, 15573096, 65494586, 13741207, 8920470, 8512526, 11834556, 15322080, 15231907, 5962612 },
+            { 38701533, 8288279, 52883594, 33416137, 50433035, 10897756, 20597419, 8350628, 30016864, 2529749 },
+            { 2570165, 20124619, 48262105, 6385253, 17751672, 12860915, 286247, 14157436, 984918, 1771233 },
+        },
+        {
+            { 50495580, 27762662, 46665021, 5415912, 53476874, 4393320, 30684377, 19810226, 13893158, 18538211 },
+            { 59308151, 2716072, 47550161, 10941845, 697776, 25963256, 16359821, 31116441, 22366750, 14197005 },
+            { 41872352, 4727231, 42401072, 20544138, 20113839, 24050409, 34293160, 26682272, 17054082, 24806628 },
+        },
+        {
+            { 30650370, 13564213, 17829349, 13324366, 46117071, 12371148, 62509652, 20013163, 42231329, 9115364 },
+            { 7352033, 9905981, 40216866, 16537901, 18121436, 2092926, 9966376, 23422563, 24939822, 26588710 },
+            { 54364473, 3293072, 63576427, 24335467, 36078380, 33275482, 21670276, 2150201, 23910396, 3246488 },
+        },
+        {
+            { 66344113, 32562814, 49164795, 25660709, 18257573, 13850901, 17791965, 3298706, 30048706, 17515043 },
+            { 7976479, 28181138, 4039679, 24270545, 26106313, 8398266, 64506267, 15795832, 7289905, 18639491 },
+            { 1462681, 8637928, 6844923, 29246727, 2845549, 7727136, 33488484, 14476319, 41992736, 7588602 },
+        },
+        {
+            { 46154031, 22775424, 18862853, 2022087, 38005042, 11635648, 24829550, 26001464, 16914091, 27375666 },
+            { 56754860, 24934316, 55883867, 5150483, 38443000, 651731, 52722558, 19607458, 5323716, 30608176 },
+            { 21206439, 24033001, 13452277, 17133677, 47212554, 27491335, 16436317, 6404067, 47047812, 27806434 },
+        },
+        {
+            { 45017951, 16211974, 17706791, 22416012, 166530, 18953908, 28955023, 31669524, 9423134, 19049186 },
+            { 30709209, 12224462, 62889755, 7508728, 23375972, 26811675, 39748196, 26671985, 37587184, 4710390 },
+            { 3208206, 31433878, 58769539, 21744432, 46514, 17066542, 38796437, 8007899, 19443785, 30936450 },
+        },
+        {
+            { 22678277, 4340058, 7435910, 21326269, 28491835, 22246273, 23820113, 4492251, 21720515, 16553995 },
+            { 34404806, 13660548, 11756599, 9893485, 61524648, 10783540, 60195077, 23926836, 41846739, 8746292 },
+            { 63631772, 9563542, 13261078, 1936790, 19258999, 32301794, 12606954, 471348, 37547150, 5227106 },
+        },
+    },
+    {
+        {
+            { 55809721, 15664637, 15253659, 12490691, 27761291, 20884422, 5164282, 12212424, 56832738, 25265623 },
+            { 63868809, 13514209, 17935985, 17959885, 47749475, 22098285, 29773432, 12133902, 66529063, 19155505 },
+            { 21030877, 5096381, 34908164, 28118926, 2376539, 17217543, 39151277, 4630726, 56005711, 27846552 },
+        },
+        {
+            { 302749, 6657501, 44393396, 17614833, 66008506, 5387942, 31893606, 14439993, 64223620, 8223520 },
+            { 59831271, 22384695, 12407513, 7790545, 28371416, 31669444, 32998572, 30082206, 65351890, 17441401 },
+            { 42781557, 13168844, 31273439, 4123707, 45943432, 33220502, 32337454, 32121887, 45116409, 9468049 },
+        },
+        {
+            { 41991096, 12527256, 50409429, 9936926, 9083964, 33328416, 52452749, 8242745, 56527829, 11475288 },
+            { 24025334, 27497963, 828732, 4217393, 20072835, 18791243, 4396882, 1239008, 66795737, 24054557 },
+            { 23834003, 24586218, 16489754, 32436426, 60178117, 18374563, 43611442, 17173762, 61879463, 8353200 },
+        },
+        {
+            { 30996393, 15313227, 22541186, 6420462, 11988094, 587701, 51978287, 20755139, 35372652, 19079812 },
+            { 31201534, 20488981, 24879436, 13212879, 59735674, 14870098, 35754424, 25284405, 3386956, 14155263 },
+            { 23356485, 5676822, 46317448, 12454213, 55087819, 33274130, 48555138, 32861190, 19350569, 17522340 },
+        },
+        {
+            { 54371772, 19026404, 54367540, 7739211, 19489352, 31829068, 4194313, 2683611, 24425611, 18143819 },
+            { 49753811, 8714490, 43837900, 13770086, 27152992, 11864267, 37646135, 10903530, 30478283, 29340775 },
+            { 5610607, 30893674, 63216558, 456705, 64006277, 9603686, 32576749, 4557380, 61264783, 1637658 },
+        },
+        {
+            { 53766433, 17771981, 42526512, 3786308, 43851756, 4534398, 46143697, 858481, 15128623, 27132990 },
+            { 55797396, 9478743, 56990298, 2757788, 53005963, 31308124, 64410467, 28029709, 4388626, 23614640 },
+            { 36208052, 14937908, 64120797, 18353409, 30089038, 26748506, 32786014, 8415886, 18190875, 30184105 },
+        },
+        {
+            { 2315467, 16627386, 55424420, 22393528, 27625792, 26097617, 42670961, 2487148, 6101555, 24293696 },
+            { 3980942, 5291291, 577711, 25835910, 42421650, 3948991, 57444969, 12206993, 35581805, 2155397 },
+            { 31693060, 5583674, 17355160, 6039283, 23914512, 29252974, 5443160, 31479963, 62752865, 17034789 },
+        },
+        {
+            { 45156193, 28709334, 48815279, 17006217, 29691256, 16930354, 62990182, 30369413, 32147345, 19683488 },
+            { 48117665, 23766040, 47984792, 26860, 17331860, 9585369, 21174325, 1789712, 10916049, 15825177 },
+            { 58798977, 4224322, 17111608, 9156467, 58431548, 4154377, 54806940, 17383830, 39809012, 25562901 },
+        },
+    },
+    {
+        {
+            { 7030396, 10563936, 1008588, 31406827, 51894885, 24695394, 65842265, 23990636, 44571864, 16130905 },
+            { 207871, 23942491, 55007606, 28920139, 58574406, 32342459, 62493526, 8304703, 62295008, 29800354 },
+            { 5166985, 27174088, 29708654, 6094085, 30981931, 30296199, 66446902, 32927459, 22609669, 13681032 },
+        },
+        {
+            { 41628084, 8798666, 188316, 28136124, 20310897, 21467940, 20665155, 24994264, 30539172, 28685941 },
+            { 32882505, 23620088, 1203211, 24028059, 10032629, 30159606, 39336889, 33140475, 23711189, 2717266 },
+            { 28344707, 6906554, 51471446, 26086113, 66475841, 17433879, 9550658, 7066928, 61585395, 13426994 },
+        },
+        {
+            { 35752845, 18390665, 25962103, 16661824, 61473480, 20881126, 5805451, 733835, 65069811, 1935646 },
+            { 10667957, 32020995, 33245069, 2325938, 7160328, 3266270, 26889770, 26295658, 16169081, 21619406 },
+            { 1455962, 4291973, 24414812, 28585311, 62021308, 27687990, 56263441, 23078108, 24067407, 24363937 },
+        },
+        {
+            { 28525224, 28544079, 50190293, 14426477, 53382541, 25105391, 36900928, 12115217, 44361581, 7229666 },
+            { 48810676, 5905606, 39370457, 16145020, 24674768, 13483070, 43905734, 29287860, 36084080, 12023802 },
+            { 40829722, 1957765, 6623562, 25722301, 1699047, 17808758, 48550656, 18916132, 56411968, 28829397 },
+        },
+        {
+            { 13295169, 32560850, 5119387, 16617876, 27926812, 10492778, 19206688, 31796865, 23069621, 18643294 },
+            { 66502095, 4606537, 3754072, 30540267, 37635653, 27139937, 36516677, 32619395, 58740416, 5658641 },
+            { 15546284, 28241131, 27089746, 28264708, 32018574, 11451106, 36575260, 29746329, 50185690, 21171546 },
+        },
+        {
+            { 53590372, 23541702, 56523261, 2909480, 64101030, 9183108, 12137205, 25166481, 31011500, 31533391 },
+            { 29557528, 19910864, 62505275, 9181376, 62580760, 1976737, 14706542, 11933743, 9466867, 7798254 },
+            { 16533792, 8288197, 66889139, 6693452, 31142616, 30343171, 26631666, 1922178, 37048064, 16666464 },
+        },
+        {
+            { 31541624, 17085534, 65789269, 27123551, 66996479, 6540839, 53604867, 12577118, 42015327, 4148742 },
+            { 33869445, 16374311, 40382512, 15737394, 27147996, 8973740, 16959411, 20141490, 20263600, 24546627 },
+            { 3596116, 27999017, 48045642, 21328718, 4337029, 22872940, 12805557, 32113691, 60812842, 26568030 },
+        },
+        {
+            { 184492, 5252852, 53794744, 2993766, 26843145, 14583276, 12509821, 31567942, 11971965, 784973 },
+            { 16909071, 2891754, 36206037, 22520606, 65155545, 7895648, 4305694, 9765558, 21505658, 2337476 },
+            { 62384756, 20725811, 5610987, 27070042, 9053656, 15893986, 50735719, 21674649, 4759878, 12649008 },
+        },
+    },
+    {
+        {
+            { 33464212, 6447153, 45678648, 21728126, 53843357, 26583174, 2286056, 19943468, 52849863, 28880380 },
+            { 37224237, 20305325, 35167547, 8277055, 61944018, 33277879, 46744313, 22084058, 7945758, 13374677 },
+            { 63133327, 596541, 26638736, 1100986, 41395946, 28840800, 59854426, 21779830, 61275115, 18057221 },
+        },
+        {
+            { 46821069, 736493, 1593599, 32556965, 23084580, 320855, 9962387, 25403569, 2452761, 28487083 },
+            { 14333812, 11129045, 6510744, 31618424, 37319984, 8621847, 34728225, 10311405, 16158158, 30566438 },
+            { 12705376, 33040395, 48987035, 33197610, 825751, 20627179, 35223683, 12633473, 21813176, 27926656 },
+        },
+        {
+            { 55569262, 7626539, 9730594, 1415637, 1322729, 11824176, 10886775, 28222186, 11648039, 22215534 },
+            { 7634869, 10796969, 24196261, 4783405, 57690769, 4695246, 47490524, 25811717, 15290668, 20307895 },
+            { 65149084, 3690845, 8957689, 22543566, 42963389, 20140867, 40887350, 13968936, 31966241, 15358294 },
+        },
+        {
+            { 12233298, 14834208, 42059922, 2593836, 20079295, 5523638, 22269394, 30408169, 17455018, 21619476 },
+            { 2806510, 21188093, 58630730, 2409743, 36561792, 25775282, 25411865, 27364266, 14935192, 729401 },
+            { 21760916, 24386826, 66507945, 29817031, 64320794, 28214118, 66478790, 2932237, 40376589, 23206237 },
+        },
+        {
+            { 31612099, 867343, 43177963, 24556554, 48373538, 8513682, 43060554, 32664096, 27227939, 27100084 },
+            { 49246487, 29658182, 39385742, 595188, 21024964, 18193303, 49332814, 20524882, 28882386, 9512534 },
+            { 3531104, 15265259, 707795, 33412129, 12268508, 8408839, 34573280, 10281821, 3245423, 3562224 },
+        },
+        {
+            { 7669217, 21834803, 38868538, 27309594, 13317120, 23249565, 55754755, 25106790, 59914144, 24115622 },
+            { 29699458, 3120605, 22488675, 27960965, 20110738, 7814545, 60724198, 17913209, 4723250, 15717190 },
+            { 10572203, 27975582, 49046279, 5032009, 49260099, 13099829, 12498725, 32579566, 53632825, 20018038 },
+        },
+        {
+            { 61470978, 21125625, 13617902, 31619802, 11591671, 24623686, 11738392, 6649420, 59622101, 15261049 },
+            { 26257131, 28169048, 43816990, 18968007, 8628742, 20010848, 45596363, 25441559, 2501319, 13551448 },
+            { 21880298, 7982027, 16322600, 12785200, 60533754, 20754384, 21113899, 6866040, 49610647, 18539805 },
+        },
+        {
+            { 22558111, 22288131, 9265730, 4186438, 11042895, 32138830, 5298116, 29615252, 59380016, 17826520 },
+            { 59776604, 33532179, 49299843, 28904485, 11283902, 18144136, 67094656, 2645168, 56916058, 14437436 },
+            { 49093059, 7199013, 38143808, 25651603, 13074474, 30021041, 21244865, 30992961, 7711947, 1747686 },
+        },
+    },
+    {
+        {
+            { 2645815, 18942828, 18609640, 8535934, 35474530, 2135962, 40913148, 11481774, 33986069, 3726901 },
+            { 20621016, 10751310, 37332481, 26020189, 11354180, 9683490, 66796536, 24489827, 59550594, 17573639 },
+            { 50813525, 10771552, 66820927, 9656324, 19885419, 4058894, 14063211, 17755909, 9920467, 1982229 },
+        },
+        {
+            { 3385738, 1234670, 40246336, 23161441, 17948023, 11331859, 19006271, 1386324, 37574880, 10262723 },
+            { 8884013, 32457994, 3420411, 15266977, 5052635, 24330659, 65317010, 26675682, 12243606, 24634933 },
+            { 13175636, 31716411, 45301356, 14192673, 62915862, 22591643, 19914267, 20301006, 44513905, 17602450 },
+        },
+        {
+            { 57275805, 18392755, 58629540, 7793365, 11085939, 11720315, 48566187, 8758950, 17054491, 24523171 },
+            { 54277267, 24230864, 51932335, 16516831, 26533242, 20393390, 43426605, 19458303, 60266215, 19241645 },
+            { 62139146, 13325176, 236998, 22590755, 56703336, 25928676, 35404675, 8843012, 54625518, 31437946 },
+        },
+        {
+            { 43183386, 22085159, 54051595, 22540856, 46213243, 15744847, 64963667, 24881459, 49530969, 24521780 },
+            { 1587616, 20467656, 36452346, 17953263, 45858815, 22880227, 25327669, 24647371, 62043695, 21725719 },
+            { 21820090, 1997481, 14475848, 22544601, 56398231, 24836093, 31358692, 27282696, 45440684, 1348304 },
+        },
+        {
+            { 58891948, 3615590, 54138755, 21344171, 9353716, 20464179, 50926900, 26294376, 53378378, 6915138 },
+            { 5523376, 22507449, 12443553, 13650176, 28553428, 7698891, 37495339, 21541684, 35745407, 23546122 },
+            { 40474540, 13621945, 53774832, 22130881, 27338200, 17478949, 49242315, 11062576, 10341151, 21762426 },
+        },
+        {
+            { 21364242, 9385891, 5918875, 13050407, 49613576, 25048472, 13319183, 5657866, 66412910, 31001380 },
+            { 55792603, 15520181, 63199601, 6124168, 66319049, 17491695, 38183018, 23837044, 39800700, 10194667 },
+            { 26605796, 16165329, 64390244, 6040533, 58303026, 5845614, 38226702, 18302968, 10575003, 2931151 },
+        },
+        {
+            { 29375061, 32500702, 56222151, 2778586, 12705468, 20833183, 44638957, 23001784, 1341092, 358819 },
+            { 25120806, 13699632, 60095191, 18864852, 41601480, 18466372, 30572940, 12606575, 14375334, 8861920 },
+            { 420408, 21632136, 31356986, 9546629, 39158009, 7047757, 53269393, 28913764, 9566446, 24599076 },
+        },
+        {
+            { 20000900, 9004137, 17712032, 24555832, 52999466, 17562912, 9814679, 15274196, 60479450, 22780688 },
+            { 64211030, 18954159, 38312309, 4561663, 5804813, 27045127, 4646190, 24975103, 14298158, 15481181 },
+            { 45988582, 20959824, 66009312, 18192112, 24676023, 5438168, 47839659, 24657195, 58257550, 2132692 },
+        },
+    },
+    {
+        {
+            { 12926894, 28932629, 67016739, 612985, 27798555, 11958898, 34062448, 8250986, 3985534, 5752383 },
+            { 8181394, 18682479, 62651626, 22493113, 4090618, 8617513, 938880, 3172702, 30667196, 26127469 },
+            { 2684044, 21092588, 13362766, 174928, 1574941, 21584728, 32246113, 1161895, 28861941, 2212274 },
+        },
+        {
+            { 11801158, 4640846, 5077395, 9665750, 9498225, 30124989, 61122267, 27268925, 64817198, 25094412 },
+            { 20200959, 19442383, 12779119, 23856478, 6959528, 13434826, 15735530, 3617225, 48998941, 19059119 },
+            { 26483408, 7918962, 32543625, 15966796, 48614699, 6700636, 33515571, 1468472, 59674225, 3882935 },
+        },
+        {
+            { 20985698, 31267066, 20524681, 24408038, 64907831, 31772131, 20073258, 8823495, 14362703, 15566306 },
+            { 13922521, 12838887, 69320, 14492027, 47754034, 28159326, 1359404, 1049363, 47937733, 31336308 },
+            { 24049330, 9045571, 25122372, 26359410, 44378522, 17525959, 13876519, 18475224, 67024691, 17357619 },
+        },
+        {
+            { 41385462, 749558, 47433595, 6315201, 29803999, 17577625, 54669762, 4072353, 28610093, 23709265 },
+            { 22405748, 30413635, 23752850, 13509993, 28416399, 27875124, 64515286, 15179141, 34397071, 9985924 },
+            { 5983042, 1013072, 10563044, 2131346, 13237016, 2787398, 37296214, 23942022, 62988286, 31422631 },
+        },
+        {
+            { 13554378, 25486331, 57888875, 10441905, 36862652, 1445542, 65003609, 17979691, 54188151, 22903195 },
+            { 62355624, 18215520, 36017685, 21938164, 21968690, 18831836, 22817407, 28675128, 51318247, 15231155 },
+            { 9423674, 952818, 1446704, 4799222, 13724062, 23866341, 63236223, 18237618, 38921994, 25944585 },
+        },
+        {
+            { 25827808, 9068954, 21900720, 17540796, 57827463, 13311815, 3119355, 25831477, 2870697, 13933703 },
+            { 33496036, 12104150, 1499403, 4839538, 5391639, 32666489, 66321727, 22198412, 11361395, 20691772 },
+            { 20957573, 10900616, 48810246, 6927440, 4333372, 12671653, 19978419, 25440714, 4386084, 11889846 },
+        },
+        {
+            { 23774515, 32788294, 63269846, 23518213, 14534867, 16100900, 40369726, 27106344, 60572698, 21535475 },
+            { 64216785, 33224314, 53379161, 28952592, 55667845, 3187127, 58460671, 14175918, 60437743, 22693595 },
+            { 65385799, 26942600, 47132477, 28580230, 29195585, 25877737, 32568502, 25197998, 31578316, 10424168 },
+        },
+        {
+            { 51313142, 760920, 31196422, 1661734, 51073672, 23237310, 1054757, 31654177, 61506221, 25110993 },
+            { 65162356, 8121487, 62926807, 16298637, 16335826, 25529834, 60386832, 2041812, 24492929, 6086127 },
+            { 2461349, 8450263, 27141221, 23289432, 35375336, 4464998, 46565015, 12937141, 63616872, 1221196 },
+        },
+    },
+    {
+        {
+            { 52172471, 24587798, 16035158, 21095385, 38994931, 22353854, 9309497, 32855190, 17539306, 19286243 },
+            { 52195001, 2041962, 16152106, 32552372, 49615420, 8032683, 50184086, 30942858, 31650477, 30794890 },
+            { 45779799, 18584734, 9403806, 3956363, 5669425, 24145903, 14897967, 1748830, 59704227, 26023913 },
+        },
+        {
+            { 30994596, 15923823, 39867002, 14674107, 57431216, 18327669, 49166015, 31444919, 13169702, 16280007 },
+            { 1435553, 12474308, 5012448, 15551904, 31734544, 32116999, 17256601, 18426279, 41825199, 22273071 },
+            { 12238178, 19462372, 17201415, 20452494, 33798029, 24707268, 1861225, 32782608, 36826161, 11632384 },
+        },
+        {
+            { 38104677, 12137536, 57817220, 939683, 35456299, 11993053, 24206801, 123570, 67066913, 30893898 },
+            { 50563919, 10765765, 32522199, 17714935, 60049628, 17664052, 66220974, 24691602, 60964291, 27442873 },
+            { 36104220, 7150989, 31173499, 28697857, 36067748, 32536499, 9215664, 9314632, 2100453, 12738185 },
+        },
+        {
+            { 43369606, 12175641, 46199852, 27372868, 5010828, 13707831, 17477840, 7104010, 47868667, 22659374 },
+            { 66631756, 10341681, 35465960, 32509331, 63243908, 15033510, 14090074, 27852890, 19720251, 19843318 },
+            { 49877689, 18000340, 35198445, 23511867, 24746365, 29936984, 47595985, 22006150, 68184, 11397287 },
+        },
+        {
+            { 50333806, 4360431, 66029168, 16202167, 46086729, 4793044, 7551089, 12806060, 51706208, 4668025 },
+            { 12701379, 2088436, 39786624, 28694052, 36978818, 6937263, 34925247, 27002461, 56219999, 23482401 },
+            { 1424065, 29213942, 4949043, 15352543, 63243545, 5323857, 35907111, 7499178, 65400644, 6104218 },
+        },
+        {
+            { 65667630, 24446308, 31115230, 17856135, 24310534, 20458636, 19359619, 3518970, 47213966, 29266106 },
+            { 6018491, 28098175, 35403451, 22482624, 38496924, 19536985, 40365659, 21272056, 1309730, 19264994 },
+            { 57882399, 27300487, 15129678, 14842587, 33420224, 16402151, 1044866, 26398660, 37058568, 31549658 },
+        },
+        {
+            { 22117315, 17868311, 47120608, 4027177, 27997531, 5928803, 20758988, 12935188, 61755686, 21340095 },
+            { 50416939, 32472920, 49377355, 14902586, 52512986, 744944, 65442862, 26340197, 12943432, 4893829 },
+            { 55821494, 27949123, 54695849, 16537160, 5885809, 13376186, 861973, 21280031, 59917106, 13542569 },
+        },
+        {
+            { 26159834, 5695496, 54087541, 3774589, 54513802, 13031687, 19183275, 30055259, 24071150, 21889802 },
+            { 60386306, 8201801, 48911290, 13042280, 3329729, 30420030, 54807359, 30811119, 42776755, 12474633 },
+            { 42568970, 29999385, 66016169, 13129721, 16000542, 31111749, 58306867, 13867539, 31961542, 31294741 },
+        },
+    },
+};
+#endif
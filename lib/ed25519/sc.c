@@ -807,3 +807,22 @@ void sc_muladd(unsigned char *s, const unsigned char *a, const unsigned char *b,
     s[30] = (unsigned char) (s11 >> 9);
     s[31] = (unsigned char) (s11 >> 17);
 }
+
+/* s < l, ie. not a malleable encoding of the scalar */
+int sc_is_canonical(const unsigned char *s) {
+    static const unsigned char l[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    int i;
+
+    for (i = 31; i >= 0; --i) {
+        if (s[i] < l[i]) {
+            return 1;
+        }
+        if (s[i] > l[i]) {
+            return 0;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Host benchmark of signing (ie. ge_scalarmult_base() and its fixed-base tables), to compare ED25519_BASE_TABLES
+// 32 vs 64 and the two field backends. Reports field multiplications and squarings per signature, which are exact and
+// repeatable, and the best of several timed runs, which is only indicative (host, not MCU).
+//
+// Not part of the firmware build (PlatformIO skips test/ dirs). Run it on a host for each configuration:
+//
+//     cc -O2 -I lib/ed25519 -D ED25519_FE64=0 -D ED25519_BASE_TABLES=32 lib/ed25519/test/bench_sign.c lib/ed25519/*.c -o /tmp/ed_bench && /tmp/ed_bench
+//
+// Add -D ED25519_COUNT_FE_OPS=1 for the field op counts (the counting adds a little to the times).
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ed_25519.h"
+#include "ge.h"
+
+#define SIGNS_PER_RUN  2000
+#define NUM_RUNS       7
+
+static double now_secs(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void) {
+    unsigned char seed[32], public_key[32], private_key[64], message[32], signature[64];
+    double best = 0;
+    int run, i;
+
+    for (i = 0; i < 32; i++) {
+        seed[i] = (unsigned char) (i * 7 + 1);
+        message[i] = (unsigned char) (i * 13 + 5);
+    }
+    ed25519_create_keypair(public_key, private_key, seed);
+
+#if ED25519_COUNT_FE_OPS
+    fe_mul_count = fe_sq_count = 0;
+    ed25519_sign(signature, message, sizeof(message), public_key, private_key);
+    printf("sign:   %lu fe_mul + %lu fe_sq = %lu field ops\n", fe_mul_count, fe_sq_count, fe_mul_count + fe_sq_count);
+
+    fe_mul_count = fe_sq_count = 0;
+    ed25519_verify(signature, message, sizeof(message), public_key);
+    printf("verify: %lu fe_mul + %lu fe_sq = %lu field ops\n", fe_mul_count, fe_sq_count, fe_mul_count + fe_sq_count);
+#endif
+
+    for (run = 0; run < NUM_RUNS; run++) {
+        double t = now_secs();
+
+        for (i = 0; i < SIGNS_PER_RUN; i++) {
+            message[0] = (unsigned char) i;
+            ed25519_sign(signature, message, sizeof(message), public_key, private_key);
+        }
+        t = now_secs() - t;
+        if (run == 0 || t < best) {
+            best = t;
+        }
+    }
+    if (ed25519_verify(signature, message, sizeof(message), public_key) != 1) {
+        printf("FAIL: verify\n");
+        return 1;
+    }
+    printf("ED25519_FE64=%d, ED25519_BASE_TABLES=%d: %.1f us/sign (best of %d runs)\n",
+           ED25519_FE64, ED25519_BASE_TABLES, best * 1e6 / SIGNS_PER_RUN, NUM_RUNS);
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Host check of the field arithmetic backends, against RFC 8032 (section 7.1, tests 1-3) and key exchange outputs
+// computed independently (X25519 of the clamped secret, with the Edwards public key mapped to Montgomery form).
+//
+// Not part of the firmware build (PlatformIO skips test/ dirs). Run it on a 64-bit host for both backends:
+//
+//     cc -O2 -I lib/ed25519 -D ED25519_FE64=0 lib/ed25519/test/test_vectors.c lib/ed25519/*.c -o /tmp/ed_fe32 && /tmp/ed_fe32
+//     cc -O2 -I lib/ed25519 -D ED25519_FE64=1 lib/ed25519/test/test_vectors.c lib/ed25519/*.c -o /tmp/ed_fe64 && /tmp/ed_fe64
+//
+// Add -D ED25519_BASE_TABLES=64 to also cover the full fixed-base table. Exits non-zero on any failure.
+
+#include <stdio.h>
+#include <string.h>
+#include "ed_25519.h"
+#include "fe.h"
+
+typedef struct {
+    const char *seed;
+    const char *public_key;
+    const char *message;
+    const char *signature;
+} sign_vector;
+
+static const sign_vector sign_vectors[] = {
+    {
+        "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+        "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+        "",
+        "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b"
+    },
+    {
+        "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+        "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+        "72",
+        "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00"
+    },
+    {
+        "c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+        "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+        "af82",
+        "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a"
+    }
+};
+
+#define NUM_VECTORS  (sizeof(sign_vectors) / sizeof(sign_vectors[0]))
+
+/* shared secret between sign_vectors[i] and sign_vectors[(i + 1) % NUM_VECTORS] */
+static const char *shared_secrets[NUM_VECTORS] = {
+    "5166f24a6918368e2af831a4affadd97af0ac326bdf143596c045967cc00230e",
+    "8647f2376df41250f4d77abae499dcfefab8040dac12fea86c6b7b2046032a23",
+    "c64b70c735c7a8f6581bf5fc287a701ad85753647b410e388692cb50b14a4e64"
+};
+
+static int failures = 0;
+
+static size_t from_hex(unsigned char *dest, const char *hex) {
+    size_t n = 0;
+    unsigned int b;
+
+    while (hex[0] && hex[1] && sscanf(hex, "%2x", &b) == 1) {
+        dest[n++] = (unsigned char) b;
+        hex += 2;
+    }
+    return n;
+}
+
+static void check(int ok, const char *what, size_t idx) {
+    if (!ok) {
+        printf("FAIL: %s (vector %u)\n", what, (unsigned) idx + 1);
+        failures++;
+    }
+}
+
+int main(void) {
+    unsigned char seed[32], public_key[NUM_VECTORS][32], private_key[NUM_VECTORS][64];
+    unsigned char message[NUM_VECTORS][8], signature[NUM_VECTORS][64], expected[64], neg_x[32];
+    size_t message_len[NUM_VECTORS];
+    size_t i;
+
+    for (i = 0; i < NUM_VECTORS; i++) {
+        const sign_vector *v = &sign_vectors[i];
+
+        from_hex(seed, v->seed);
+        ed25519_create_keypair(public_key[i], private_key[i], seed);
+        from_hex(expected, v->public_key);
+        check(memcmp(public_key[i], expected, 32) == 0, "public key", i);
+
+        message_len[i] = from_hex(message[i], v->message);
+        ed25519_sign(signature[i], message[i], message_len[i], public_key[i], private_key[i]);
+        from_hex(expected, v->signature);
+        check(memcmp(signature[i], expected, 64) == 0, "signature", i);
+
+        check(ed25519_verify(signature[i], message[i], message_len[i], public_key[i]) == 1, "verify", i);
+        check(ed25519_decompress_key(neg_x, public_key[i]) == 1, "decompress key", i);
+        check(ed25519_verify_negx(signature[i], message[i], message_len[i], public_key[i], neg_x) == 1, "verify_negx", i);
+
+        signature[i][0] ^= 1;
+        check(ed25519_verify(signature[i], message[i], message_len[i], public_key[i]) == 0, "reject tampered R", i);
+        signature[i][0] ^= 1;
+        signature[i][40] ^= 1;
+        check(ed25519_verify_negx(signature[i], message[i], message_len[i], public_key[i], neg_x) == 0, "reject tampered s", i);
+        signature[i][40] ^= 1;
+    }
+
+    {
+        const unsigned char *sigs[NUM_VECTORS], *msgs[NUM_VECTORS], *keys[NUM_VECTORS];
+        unsigned char random_scalars[16 * NUM_VECTORS];
+
+        for (i = 0; i < NUM_VECTORS; i++) {
+            sigs[i] = signature[i];
+            msgs[i] = message[i];
+            keys[i] = public_key[i];
+        }
+        for (i = 0; i < sizeof(random_scalars); i++) {
+            random_scalars[i] = (unsigned char) (i * 37 + 11);
+        }
+        check(ed25519_verify_batch(sigs, msgs, message_len, keys, NULL, NUM_VECTORS, random_scalars) == 1, "verify_batch", 0);
+
+        signature[1][10] ^= 1;
+        check(ed25519_verify_batch(sigs, msgs, message_len, keys, NULL, NUM_VECTORS, random_scalars) == 0, "batch rejects tampered", 1);
+        signature[1][10] ^= 1;
+    }
+
+    for (i = 0; i < NUM_VECTORS; i++) {
+        size_t j = (i + 1) % NUM_VECTORS;
+        unsigned char secret_ij[32], secret_ji[32];
+
+        ed25519_key_exchange(secret_ij, public_key[j], private_key[i]);
+        ed25519_key_exchange(secret_ji, public_key[i], private_key[j]);
+        from_hex(expected, shared_secrets[i]);
+        check(memcmp(secret_ij, expected, 32) == 0, "key exchange", i);
+        check(memcmp(secret_ji, expected, 32) == 0, "key exchange (reverse)", i);
+    }
+
+    printf("ED25519_FE64=%d: %s\n", ED25519_FE64, failures ? "FAILED" : "all passed");
+    return failures ? 1 : 0;
+}
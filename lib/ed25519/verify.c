@@ -51,7 +51,7 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
     ge_p3 A;
     ge_p2 R;
 
-    if (signature[63] & 224) {
+    if (!sc_is_canonical(signature + 32)) {   /* same check as the negx and batch paths */
         return 0;
     }
 
@@ -75,3 +75,43 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
 
     return 1;
 }
+
+int ed25519_decompress_key(unsigned char *neg_x, const unsigned char *public_key) {
+    ge_p3 A;
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return 0;
+    }
+    fe_tobytes(neg_x, A.X);   /* Z is 1 */
+    return 1;
+}
+
+int ed25519_verify_negx(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *neg_x) {
+    unsigned char h[64];
+    unsigned char checker[32];
+    sha512_context hash;
+    ge_p3 A;
+    ge_p2 R;
+
+    if (!sc_is_canonical(signature + 32)) {
+        return 0;
+    }
+
+    ge_frombytes_negx(&A, neg_x, public_key);
+
+    sha512_init(&hash);
+    sha512_update(&hash, signature, 32);
+    sha512_update(&hash, public_key, 32);
+    sha512_update(&hash, message, message_len);
+    sha512_final(&hash, h);
+
+    sc_reduce(h);
+    ge_double_scalarmult_vartime(&R, h, &A, signature + 32);
+    ge_tobytes(checker, &R);
+
+    if (!consttime_equal(checker, signature)) {
+        return 0;
+    }
+
+    return 1;
+}
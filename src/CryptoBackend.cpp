@@ -0,0 +1,418 @@
+#include "CryptoBackend.h"
+#include <string.h>
+
+#if MESH_CRYPTO_ACCEL
+  #include <cpuid.h>
+  #include <immintrin.h>
+#endif
+
+namespace mesh {
+
+const uint32_t CryptoBackend::SHA256_INIT[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR32(x, n)  (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_block(uint32_t h[8], const uint8_t block[64]) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; i++) {
+    w[i] = ((uint32_t)block[i*4] << 24) | ((uint32_t)block[i*4 + 1] << 16) | ((uint32_t)block[i*4 + 2] << 8) | block[i*4 + 3];
+  }
+  for (int i = 16; i < 64; i++) {
+    uint32_t s0 = ROTR32(w[i-15], 7) ^ ROTR32(w[i-15], 18) ^ (w[i-15] >> 3);
+    uint32_t s1 = ROTR32(w[i-2], 17) ^ ROTR32(w[i-2], 19) ^ (w[i-2] >> 10);
+    w[i] = w[i-16] + s0 + w[i-7] + s1;
+  }
+
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], hh = h[7];
+  for (int i = 0; i < 64; i++) {
+    uint32_t t1 = hh + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+    uint32_t t2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+    hh = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+  h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e; h[5] += f; h[6] += g; h[7] += hh;
+}
+
+#if MESH_CRYPTO_ACCEL
+
+static int cpu_features = -1;   // bit 0: AES-NI, bit 1: SHA-NI, bit 2: AVX2
+
+static int getCPUFeatures() {
+  if (cpu_features < 0) {
+    unsigned int eax, ebx, ecx, edx;
+    int f = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+      bool sse = (ecx & bit_SSSE3) && (ecx & bit_SSE4_1);
+      bool ymm = false;
+      if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+        unsigned int xcr0_lo, xcr0_hi;
+        __asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        ymm = (xcr0_lo & 6) == 6;   // OS saves the XMM and YMM registers
+      }
+      if (sse && (ecx & bit_AES)) f |= 1;
+      if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        if (sse && (ebx & bit_SHA)) f |= 2;
+        if (ymm && (ebx & bit_AVX2)) f |= 4;
+      }
+    }
+    cpu_features = f;
+  }
+  return cpu_features;
+}
+
+#define AES_EXPAND(k, rcon)  aesExpandStep(k, _mm_aeskeygenassist_si128(k, rcon))
+
+__attribute__((target("aes,sse4.1")))
+static __m128i aesExpandStep(__m128i key, __m128i gen) {
+  gen = _mm_shuffle_epi32(gen, 0xFF);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, gen);
+}
+
+__attribute__((target("aes,sse4.1")))
+static void aesniSetKey(uint8_t* enc, uint8_t* dec, const uint8_t* key) {
+  __m128i* rk = (__m128i *) enc;
+  __m128i* dk = (__m128i *) dec;
+
+  rk[0] = _mm_loadu_si128((const __m128i *) key);
+  rk[1] = AES_EXPAND(rk[0], 0x01);
+  rk[2] = AES_EXPAND(rk[1], 0x02);
+  rk[3] = AES_EXPAND(rk[2], 0x04);
+  rk[4] = AES_EXPAND(rk[3], 0x08);
+  rk[5] = AES_EXPAND(rk[4], 0x10);
+  rk[6] = AES_EXPAND(rk[5], 0x20);
+  rk[7] = AES_EXPAND(rk[6], 0x40);
+  rk[8] = AES_EXPAND(rk[7], 0x80);
+  rk[9] = AES_EXPAND(rk[8], 0x1B);
+  rk[10] = AES_EXPAND(rk[9], 0x36);
+
+  dk[0] = rk[10];
+  for (int i = 1; i < 10; i++) {
+    dk[i] = _mm_aesimc_si128(rk[10 - i]);
+  }
+  dk[10] = rk[0];
+}
+
+__attribute__((target("aes,sse4.1")))
+static void aesniEncrypt(const uint8_t* enc, uint8_t* dest, const uint8_t* src) {
+  const __m128i* rk = (const __m128i *) enc;
+  __m128i m = _mm_xor_si128(_mm_loadu_si128((const __m128i *) src), rk[0]);
+  for (int i = 1; i < 10; i++) {
+    m = _mm_aesenc_si128(m, rk[i]);
+  }
+  _mm_storeu_si128((__m128i *) dest, _mm_aesenclast_si128(m, rk[10]));
+}
+
+__attribute__((target("aes,sse4.1")))
+static void aesniDecrypt(const uint8_t* dec, uint8_t* dest, const uint8_t* src) {
+  const __m128i* dk = (const __m128i *) dec;
+  __m128i m = _mm_xor_si128(_mm_loadu_si128((const __m128i *) src), dk[0]);
+  for (int i = 1; i < 10; i++) {
+    m = _mm_aesdec_si128(m, dk[i]);
+  }
+  _mm_storeu_si128((__m128i *) dest, _mm_aesdeclast_si128(m, dk[10]));
+}
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static void shaniBlocks(uint32_t state[8], const uint8_t* data, size_t num_blocks) {
+  const __m128i BSWAP = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i state0, state1, msg, tmp, abef_save, cdgh_save;
+  __m128i w[4];
+
+  tmp = _mm_loadu_si128((const __m128i *) &state[0]);
+  state1 = _mm_loadu_si128((const __m128i *) &state[4]);
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);            // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1B);      // EFGH
+  state0 = _mm_alignr_epi8(tmp, state1, 8);      // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);   // CDGH
+
+  while (num_blocks-- > 0) {
+    abef_save = state0;
+    cdgh_save = state1;
+
+    for (int i = 0; i < 16; i++) {   // 4 rounds each
+      if (i < 4) {
+        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + i*16)), BSWAP);
+      } else {
+        __m128i w4 = w[i & 3], w3 = w[(i + 1) & 3], w2 = w[(i + 2) & 3], w1 = w[(i + 3) & 3];
+        tmp = _mm_add_epi32(_mm_sha256msg1_epu32(w4, w3), _mm_alignr_epi8(w1, w2, 4));
+        w[i & 3] = _mm_sha256msg2_epu32(tmp, w1);
+      }
+      msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *) &sha256_k[i*4]));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    }
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+    data += 64;
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B);         // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xB1);      // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);   // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8);      // ABEF
+  _mm_storeu_si128((__m128i *) &state[0], state0);
+  _mm_storeu_si128((__m128i *) &state[4], state1);
+}
+
+// a message being hashed in one SIMD lane
+struct LaneMsg {
+  const uint8_t* data;
+  size_t full_blocks;   // read directly from 'data'
+  size_t num_blocks;    // .. plus the final block(s) in 'tail', with the padding and length
+  uint8_t tail[128];
+};
+
+static void initLaneMsg(LaneMsg& m, const uint8_t* data, size_t len) {
+  m.data = data;
+  m.full_blocks = len / 64;
+
+  size_t rem = len % 64;
+  size_t tail_len = (rem < 56) ? 64 : 128;
+  memset(m.tail, 0, tail_len);
+  memcpy(m.tail, data + m.full_blocks*64, rem);
+  m.tail[rem] = 0x80;
+  uint64_t total_bits = (uint64_t)len * 8;
+  for (int i = 0; i < 8; i++) {
+    m.tail[tail_len - 1 - i] = (uint8_t) (total_bits >> (i*8));
+  }
+  m.num_blocks = m.full_blocks + tail_len/64;
+}
+
+typedef uint32_t v4u32 __attribute__((vector_size(16)));
+typedef uint32_t v8u32 __attribute__((vector_size(32)));
+
+// N messages in parallel, one per lane of V. Written with the compiler's vector extensions, so the same code
+// becomes SSE2 or AVX2, depending on the target of the function it is inlined into.
+template <typename V, int N>
+static inline __attribute__((always_inline)) void sha256Lanes(const LaneMsg* msgs[], uint8_t* const hashes[], size_t hash_len) {
+  static const uint8_t zero_block[64] = {0};
+  V st[8];
+  for (int i = 0; i < 8; i++) {
+    for (int l = 0; l < N; l++) st[i][l] = CryptoBackend::SHA256_INIT[i];
+  }
+
+  size_t max_blocks = 0;
+  for (int l = 0; l < N; l++) {
+    if (msgs[l] && msgs[l]->num_blocks > max_blocks) max_blocks = msgs[l]->num_blocks;
+  }
+
+  for (size_t b = 0; b < max_blocks; b++) {
+    V w[16];
+    V active;   // lanes whose message has not ended yet
+    for (int l = 0; l < N; l++) {
+      const uint8_t* p = zero_block;
+      active[l] = 0;
+      if (msgs[l] && b < msgs[l]->num_blocks) {
+        p = (b < msgs[l]->full_blocks) ? msgs[l]->data + b*64 : &msgs[l]->tail[(b - msgs[l]->full_blocks)*64];
+        active[l] = 0xFFFFFFFF;
+      }
+      for (int j = 0; j < 16; j++) {
+        w[j][l] = ((uint32_t)p[j*4] << 24) | ((uint32_t)p[j*4 + 1] << 16) | ((uint32_t)p[j*4 + 2] << 8) | p[j*4 + 3];
+      }
+    }
+
+    V a = st[0], bb = st[1], c = st[2], d = st[3], e = st[4], f = st[5], g = st[6], hh = st[7];
+    for (int i = 0; i < 64; i++) {
+      if (i >= 16) {
+        V w15 = w[(i - 15) & 15], w2 = w[(i - 2) & 15];
+        V s0 = ROTR32(w15, 7) ^ ROTR32(w15, 18) ^ (w15 >> 3);
+        V s1 = ROTR32(w2, 17) ^ ROTR32(w2, 19) ^ (w2 >> 10);
+        w[i & 15] += s0 + w[(i - 7) & 15] + s1;
+      }
+      V t1 = hh + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i & 15];
+      V t2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + ((a & bb) ^ (a & c) ^ (bb & c));
+      hh = g; g = f; f = e; e = d + t1;
+      d = c; c = bb; bb = a; a = t1 + t2;
+    }
+    st[0] += a & active; st[1] += bb & active; st[2] += c & active; st[3] += d & active;
+    st[4] += e & active; st[5] += f & active; st[6] += g & active; st[7] += hh & active;
+  }
+
+  for (int l = 0; l < N; l++) {
+    if (msgs[l] == NULL) continue;
+    uint8_t digest[32];
+    for (int i = 0; i < 8; i++) {
+      uint32_t v = st[i][l];
+      digest[i*4] = v >> 24; digest[i*4 + 1] = v >> 16; digest[i*4 + 2] = v >> 8; digest[i*4 + 3] = v;
+    }
+    memcpy(hashes[l], digest, hash_len);
+  }
+}
+
+static void sha256x4(const LaneMsg* msgs[], uint8_t* const hashes[], size_t hash_len) {
+  sha256Lanes<v4u32, 4>(msgs, hashes, hash_len);
+}
+
+__attribute__((target("avx2")))
+static void sha256x8(const LaneMsg* msgs[], uint8_t* const hashes[], size_t hash_len) {
+  sha256Lanes<v8u32, 8>(msgs, hashes, hash_len);
+}
+
+bool CryptoBackend::hasAESAccel() { return (getCPUFeatures() & 1) != 0; }
+bool CryptoBackend::hasSHAAccel() { return (getCPUFeatures() & 2) != 0; }
+bool CryptoBackend::hasAVX2() { return (getCPUFeatures() & 4) != 0; }
+
+#else
+
+bool CryptoBackend::hasAESAccel() { return false; }
+bool CryptoBackend::hasSHAAccel() { return false; }
+bool CryptoBackend::hasAVX2() { return false; }
+
+#endif
+
+void CryptoBackend::sha256Blocks(uint32_t state[8], const uint8_t* blocks, size_t num_blocks) {
+#if MESH_CRYPTO_ACCEL
+  if (hasSHAAccel()) {
+    shaniBlocks(state, blocks, num_blocks);
+    return;
+  }
+#endif
+  while (num_blocks-- > 0) {
+    sha256_block(state, blocks);
+    blocks += 64;
+  }
+}
+
+void CryptoBackend::sha256Multi(int count, const uint8_t* const msgs[], const size_t msg_lens[], uint8_t* const hashes[], size_t hash_len) {
+  if (hash_len > 32) hash_len = 32;
+#if MESH_CRYPTO_ACCEL
+  if (!hasSHAAccel() && count > 1) {   // NOTE: SHA-NI, one at a time, is quicker than the SIMD lanes
+    int lanes = hasAVX2() ? 8 : 4;
+    LaneMsg m[8];
+    const LaneMsg* mp[8];
+    for (int i = 0; i < count; i += lanes) {
+      for (int l = 0; l < lanes; l++) {
+        if (i + l < count) {
+          initLaneMsg(m[l], msgs[i + l], msg_lens[i + l]);
+          mp[l] = &m[l];
+        } else {
+          mp[l] = NULL;   // unused lane
+        }
+      }
+      if (lanes == 8) {
+        sha256x8(mp, &hashes[i], hash_len);
+      } else {
+        sha256x4(mp, &hashes[i], hash_len);
+      }
+    }
+    return;
+  }
+#endif
+  for (int i = 0; i < count; i++) {
+    SHA256Hash sha;
+    sha.update(msgs[i], msg_lens[i]);
+    sha.finalize(hashes[i], hash_len);
+  }
+}
+
+void AESKey::setKey(const uint8_t* key) {
+#if MESH_CRYPTO_ACCEL
+  if (CryptoBackend::hasAESAccel()) {
+    aesniSetKey(_enc, _dec, key);
+    return;
+  }
+#endif
+  _aes.setKey(key, CIPHER_KEY_SIZE);
+}
+
+void AESKey::encryptBlock(uint8_t* dest, const uint8_t* src) {
+#if MESH_CRYPTO_ACCEL
+  if (CryptoBackend::hasAESAccel()) {
+    aesniEncrypt(_enc, dest, src);
+    return;
+  }
+#endif
+  _aes.encryptBlock(dest, src);
+}
+
+void AESKey::decryptBlock(uint8_t* dest, const uint8_t* src) {
+#if MESH_CRYPTO_ACCEL
+  if (CryptoBackend::hasAESAccel()) {
+    aesniDecrypt(_dec, dest, src);
+    return;
+  }
+#endif
+  _aes.decryptBlock(dest, src);
+}
+
+void AESKey::clear() {
+#if MESH_CRYPTO_ACCEL
+  memset(_enc, 0, sizeof(_enc));
+  memset(_dec, 0, sizeof(_dec));
+#endif
+  _aes.clear();
+}
+
+void SHA256Hash::reset() {
+  memcpy(_state, CryptoBackend::SHA256_INIT, sizeof(_state));
+  _buf_len = 0;
+  _total_len = 0;
+}
+
+void SHA256Hash::resume(const uint32_t state[8], uint32_t consumed_len) {
+  memcpy(_state, state, sizeof(_state));
+  _buf_len = 0;
+  _total_len = consumed_len;
+}
+
+void SHA256Hash::update(const void* data, size_t len) {
+  const uint8_t* sp = (const uint8_t *) data;
+  _total_len += len;
+
+  if (_buf_len > 0) {   // top up partial block first
+    size_t n = 64 - _buf_len;
+    if (n > len) n = len;
+    memcpy(&_buf[_buf_len], sp, n);
+    _buf_len += n; sp += n; len -= n;
+    if (_buf_len < 64) return;
+    CryptoBackend::sha256Blocks(_state, _buf, 1);
+    _buf_len = 0;
+  }
+  if (len >= 64) {
+    CryptoBackend::sha256Blocks(_state, sp, len / 64);
+    sp += len & ~(size_t)63;
+    len &= 63;
+  }
+  memcpy(_buf, sp, len);
+  _buf_len = len;
+}
+
+void SHA256Hash::finalize(uint8_t* hash, size_t hash_len) {
+  uint64_t total_bits = _total_len * 8;
+
+  uint8_t tail[128];
+  memset(tail, 0, sizeof(tail));
+  memcpy(tail, _buf, _buf_len);
+  tail[_buf_len] = 0x80;
+  int tail_len = (_buf_len < 56) ? 64 : 128;
+  for (int i = 0; i < 8; i++) {
+    tail[tail_len - 1 - i] = (uint8_t) (total_bits >> (i*8));
+  }
+  CryptoBackend::sha256Blocks(_state, tail, tail_len / 64);
+
+  uint8_t digest[32];
+  for (int i = 0; i < 8; i++) {
+    digest[i*4] = _state[i] >> 24; digest[i*4 + 1] = _state[i] >> 16; digest[i*4 + 2] = _state[i] >> 8; digest[i*4 + 3] = _state[i];
+  }
+  memcpy(hash, digest, hash_len > sizeof(digest) ? sizeof(digest) : hash_len);
+}
+
+}
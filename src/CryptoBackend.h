@@ -0,0 +1,84 @@
+#pragma once
+
+#include <MeshCore.h>
+#include <AES.h>
+
+#ifndef MESH_CRYPTO_ACCEL
+  #if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define MESH_CRYPTO_ACCEL   1     // use AES-NI / SHA-NI instructions, when the CPU has them
+  #else
+    #define MESH_CRYPTO_ACCEL   0
+  #endif
+#endif
+
+namespace mesh {
+
+/**
+ * \brief  An expanded AES128 key. Uses the AES-NI instructions if built with MESH_CRYPTO_ACCEL and the CPU has them,
+ *         otherwise the portable AES128 class.
+*/
+class AESKey {
+#if MESH_CRYPTO_ACCEL
+  uint8_t _enc[11*16] __attribute__((aligned(16)));   // round keys
+  uint8_t _dec[11*16] __attribute__((aligned(16)));   // .. for the 'equivalent inverse cipher'
+#endif
+  AES128 _aes;
+
+public:
+  /**
+   * \param  key  must be CIPHER_KEY_SIZE bytes
+  */
+  void setKey(const uint8_t* key);
+  void encryptBlock(uint8_t* dest, const uint8_t* src);
+  void decryptBlock(uint8_t* dest, const uint8_t* src);
+  void clear();
+};
+
+/**
+ * \brief  Incremental SHA256, on top of CryptoBackend::sha256Blocks().
+*/
+class SHA256Hash {
+  uint32_t _state[8];
+  uint8_t _buf[64];
+  uint32_t _buf_len;
+  uint64_t _total_len;
+
+public:
+  SHA256Hash() { reset(); }
+
+  void reset();
+
+  /**
+   * \brief  continue from an intermediate 'state', after 'consumed_len' bytes (must be a multiple of 64) were hashed
+  */
+  void resume(const uint32_t state[8], uint32_t consumed_len);
+
+  void update(const void* data, size_t len);
+  void finalize(uint8_t* hash, size_t hash_len);
+};
+
+/**
+ * \brief  The block primitives under Utils, CryptoContext and Packet, selected at build time (see MESH_CRYPTO_ACCEL).
+*/
+class CryptoBackend {
+public:
+  static const uint32_t SHA256_INIT[8];
+
+  /**
+   * \brief  the SHA256 compression function, applied to 'num_blocks' consecutive 64-byte blocks
+  */
+  static void sha256Blocks(uint32_t state[8], const uint8_t* blocks, size_t num_blocks);
+
+  /**
+   * \brief  SHA256 of 'count' independent messages. With MESH_CRYPTO_ACCEL (and no SHA-NI) these are hashed 4 or 8
+   *         at a time, in SIMD lanes (SSE2/AVX2), otherwise one by one.
+   * \param  hashes  OUT - each truncated to 'hash_len' bytes
+  */
+  static void sha256Multi(int count, const uint8_t* const msgs[], const size_t msg_lens[], uint8_t* const hashes[], size_t hash_len);
+
+  static bool hasAESAccel();
+  static bool hasSHAAccel();
+  static bool hasAVX2();
+};
+
+}
@@ -0,0 +1,99 @@
+#include "CryptoContext.h"
+#include <string.h>
+
+namespace mesh {
+
+CryptoContext::CryptoContext() {
+  _use_counter = 0;
+  for (int i = 0; i < CIPHER_CACHE_SIZE; i++) {
+    _entries[i].last_used = 0;
+  }
+}
+
+void CryptoContext::clear() {
+  for (int i = 0; i < CIPHER_CACHE_SIZE; i++) {
+    _entries[i].aes.clear();
+    memset(_entries[i].secret, 0, PUB_KEY_SIZE);
+    _entries[i].last_used = 0;
+  }
+}
+
+CryptoContext::Entry* CryptoContext::lookup(const uint8_t* shared_secret) {
+  for (int i = 0; i < CIPHER_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->last_used && memcmp(e->secret, shared_secret, PUB_KEY_SIZE) == 0) {
+      e->last_used = ++_use_counter;
+      return e;
+    }
+  }
+  return NULL;  // not cached
+}
+
+CryptoContext::Entry* CryptoContext::getEntry(const uint8_t* shared_secret) {
+  Entry* e = lookup(shared_secret);
+  if (e) return e;
+
+  e = &_entries[0];
+  for (int i = 1; i < CIPHER_CACHE_SIZE; i++) {   // find least recently used slot
+    if (_entries[i].last_used < e->last_used) e = &_entries[i];
+  }
+  memcpy(e->secret, shared_secret, PUB_KEY_SIZE);
+  e->aes.setKey(shared_secret);
+  Utils::initHMAC(e->hmac, shared_secret, PUB_KEY_SIZE);
+  e->last_used = ++_use_counter;
+  return e;
+}
+
+int CryptoContext::encryptThenMAC(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len, uint8_t mac_size) {
+  Entry* e = getEntry(shared_secret);
+
+  uint8_t* dp = dest + mac_size;
+  while (src_len >= 16) {
+    e->aes.encryptBlock(dp, src);
+    dp += 16; src += 16; src_len -= 16;
+  }
+  if (src_len > 0) {  // remaining partial block
+    uint8_t tmp[16];
+    memset(tmp, 0, 16);
+    memcpy(tmp, src, src_len);
+    e->aes.encryptBlock(dp, tmp);
+    dp += 16;
+  }
+  int enc_len = dp - (dest + mac_size);
+
+  Utils::calcHMAC(e->hmac, dest, mac_size, dest + mac_size, enc_len);
+
+  return mac_size + enc_len;
+}
+
+int CryptoContext::MACThenDecrypt(const HMACState* hmac, const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len, uint8_t mac_size) {
+  if (src_len <= mac_size) return 0;  // invalid src bytes
+
+  Entry* e = NULL;
+  if (hmac == NULL) {
+    e = lookup(shared_secret);
+    if (e) hmac = &e->hmac;
+  }
+  bool valid;
+  if (hmac) {
+    valid = Utils::verifyMAC(*hmac, src, src_len, mac_size);
+  } else {
+    HMACState tmp;   // NOTE: don't populate cache until MAC is known to be valid
+    Utils::initHMAC(tmp, shared_secret, PUB_KEY_SIZE);
+    valid = Utils::verifyMAC(tmp, src, src_len, mac_size);
+  }
+  if (!valid) return 0;  // invalid HMAC
+
+  if (e == NULL) e = getEntry(shared_secret);
+
+  uint8_t* dp = dest;
+  const uint8_t* sp = src + mac_size;
+  const uint8_t* ep = src + src_len;
+  while (sp < ep) {
+    e->aes.decryptBlock(dp, sp);
+    dp += 16; sp += 16;
+  }
+  return dp - dest;  // will always be multiple of 16
+}
+
+}
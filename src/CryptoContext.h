@@ -0,0 +1,53 @@
+#pragma once
+
+#include <MeshCore.h>
+#include <Utils.h>
+#include "CryptoBackend.h"
+
+#ifndef CIPHER_CACHE_SIZE
+  #define CIPHER_CACHE_SIZE   8
+#endif
+
+namespace mesh {
+
+/**
+ * \brief  Caches the expanded AES128 key schedules (and HMAC states) of recently used shared secrets,
+ *         so that the key expansion isn't repeated for every packet to/from the same contact/client/channel.
+*/
+class CryptoContext {
+  struct Entry {
+    uint8_t secret[PUB_KEY_SIZE];
+    HMACState hmac;
+    AESKey aes;
+    uint32_t last_used;   // zero if slot unused
+  };
+  Entry _entries[CIPHER_CACHE_SIZE];
+  uint32_t _use_counter;
+
+  Entry* lookup(const uint8_t* shared_secret);
+  Entry* getEntry(const uint8_t* shared_secret);   // lookup, or evict least recently used
+
+public:
+  CryptoContext();
+
+  /**
+   * \brief  same as Utils::encryptThenMAC(), but using the cached key schedule for 'shared_secret'.
+   * \param  mac_size  CIPHER_MAC_SIZE (V1) or CIPHER_MAC_SIZE_V2
+   * \returns  total length of bytes in 'dest' (MAC + ciphertext)
+  */
+  int encryptThenMAC(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len, uint8_t mac_size=CIPHER_MAC_SIZE);
+
+  /**
+   * \brief  same as Utils::MACThenDecrypt(). The key schedule is only looked up (or expanded) once the MAC is valid.
+   * \param  hmac  (optional) the pre-computed HMAC state of 'shared_secret', can be NULL
+   * \returns  zero if MAC is invalid, otherwise the length of decrypted bytes in 'dest'
+  */
+  int MACThenDecrypt(const HMACState* hmac, const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len, uint8_t mac_size=CIPHER_MAC_SIZE);
+
+  /**
+   * \brief  removes all cached key schedules
+  */
+  void clear();
+};
+
+}
@@ -157,6 +157,8 @@ void Dispatcher::checkRecv() {
             memcpy(pkt->payload, &raw[i], pkt->payload_len);
 
             pkt->_snr = _radio->getLastSNR() * 4.0f;
+            pkt->_cancel_ack = 0;
+            pkt->_can_bundle = false;
             score = _radio->packetScore(_radio->getLastSNR(), len);
             air_time = _radio->getEstAirtimeFor(len);
             rx_air_time += air_time;
@@ -210,7 +212,10 @@ void Dispatcher::checkRecv() {
 }
 
 void Dispatcher::processRecvPacket(Packet* pkt) {
-  DispatcherAction action = onRecvPacket(pkt);
+  processAction(pkt, onRecvPacket(pkt));
+}
+
+void Dispatcher::processAction(Packet* pkt, DispatcherAction action) {
   if (action == ACTION_RELEASE) {
     _mgr->free(pkt);
   } else if (action == ACTION_MANUAL_HOLD) {
@@ -303,6 +308,8 @@ Packet* Dispatcher::obtainNewPacket() {
   } else {
     pkt->payload_len = pkt->path_len = 0;
     pkt->_snr = 0;
+    pkt->_cancel_ack = 0;
+    pkt->_can_bundle = false;
   }
   return pkt;
 }
@@ -320,6 +327,26 @@ void Dispatcher::sendPacket(Packet* packet, uint8_t priority, uint32_t delay_mil
   }
 }
 
+int Dispatcher::cancelOutboundByHash(const uint8_t* hash) {
+  int n = 0;
+  Packet* pkt;
+  while ((pkt = _mgr->removeOutboundByHash(hash)) != NULL) {
+    releasePacket(pkt);
+    n++;
+  }
+  return n;
+}
+
+int Dispatcher::cancelOutboundByAck(uint32_t ack_crc) {
+  int n = 0;
+  Packet* pkt;
+  while ((pkt = _mgr->removeOutboundByAck(ack_crc)) != NULL) {
+    releasePacket(pkt);
+    n++;
+  }
+  return n;
+}
+
 // Utility function -- handles the case where millis() wraps around back to zero
 //   2's complement arithmetic will handle any unsigned subtraction up to HALF the word size (32-bits in this case)
 bool Dispatcher::millisHasNowPassed(unsigned long timestamp) const {
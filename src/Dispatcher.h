@@ -93,6 +93,8 @@ public:
   virtual int getFreeCount() const = 0;
   virtual Packet* getOutboundByIdx(int i) = 0;
   virtual Packet* removeOutboundByIdx(int i) = 0;
+  virtual Packet* removeOutboundByHash(const uint8_t* hash) = 0;   // first queued packet with this packet hash, or NULL
+  virtual Packet* removeOutboundByAck(uint32_t ack_crc) = 0;   // first queued ACK with this CRC, or packet made redundant by it, or NULL
   virtual void queueInbound(Packet* packet, uint32_t scheduled_for) = 0;
   virtual Packet* getNextInbound(uint32_t now) = 0;
 };
@@ -146,6 +148,11 @@ protected:
 
   virtual DispatcherAction onRecvPacket(Packet* pkt) = 0;
 
+  /**
+   * \brief  carry out the action for a received packet, ie. for one returned by onRecvPacket() as ACTION_MANUAL_HOLD, later
+  */
+  void processAction(Packet* pkt, DispatcherAction action);
+
   virtual void logRxRaw(float snr, float rssi, const uint8_t raw[], int len) { }   // custom hook
 
   virtual void logRx(Packet* packet, int len, float score) { }   // hooks for custom logging
@@ -168,6 +175,18 @@ public:
   void releasePacket(Packet* packet);
   void sendPacket(Packet* packet, uint8_t priority, uint32_t delay_millis=0);
 
+  /**
+   * \brief  withdraw (and release) any queued outbound packets with the given packet hash (see Packet::calculatePacketHash())
+   * \returns  number of packets cancelled
+  */
+  int cancelOutboundByHash(const uint8_t* hash);
+
+  /**
+   * \brief  withdraw (and release) any queued outbound ACKs with the given CRC, and any packets which this ACK makes redundant
+   * \returns  number of packets cancelled
+  */
+  int cancelOutboundByAck(uint32_t ack_crc);
+
   unsigned long getTotalAirTime() const { return total_air_time; }  // in milliseconds
   unsigned long getReceiveAirTime() const {return rx_air_time; }
   uint32_t getNumSentFlood() const { return n_sent_flood; }
@@ -23,6 +23,55 @@ bool Identity::verify(const uint8_t* sig, const uint8_t* message, int msg_len) c
 #endif
 }
 
+bool Identity::verify(const uint8_t* sig, const uint8_t* message, int msg_len, const uint8_t* neg_x) const {
+  return ed25519_verify_negx(sig, message, msg_len, pub_key, neg_x);
+}
+
+bool Identity::verifyBatch(int count, const uint8_t* const sigs[], const uint8_t* const pub_keys[], const uint8_t* const messages[], const int msg_lens[], RNG* rng,
+                           const uint8_t* const neg_xs[]) {
+  if (count <= 0 || count > ED25519_BATCH_MAX) return false;
+
+  uint8_t z[16*ED25519_BATCH_MAX];
+  size_t lens[ED25519_BATCH_MAX];
+  rng->random(z, 16*count);
+  for (int i = 0; i < count; i++) {
+    lens[i] = msg_lens[i];
+  }
+  return ed25519_verify_batch(sigs, messages, lens, pub_keys, neg_xs, count, z);
+}
+
+#if KEY_POINT_CACHE_SIZE
+void KeyPointCache::clear() {
+  memset(_entries, 0, sizeof(_entries));
+  _use_counter = 0;
+}
+
+bool KeyPointCache::lookup(const uint8_t* pub_key, uint8_t* neg_x) {
+  Entry* victim = &_entries[0];
+  for (int i = 0; i < KEY_POINT_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->last_used && memcmp(e->pub_key, pub_key, PUB_KEY_SIZE) == 0) {
+      e->last_used = ++_use_counter;
+      memcpy(neg_x, e->neg_x, PUB_KEY_SIZE);
+      return true;
+    }
+    if (e->last_used < victim->last_used) victim = e;   // unused, or least recently used
+  }
+
+  if (!ed25519_decompress_key(neg_x, pub_key)) return false;   // not cached, as these are usually one-off forgeries
+
+  memcpy(victim->pub_key, pub_key, PUB_KEY_SIZE);
+  memcpy(victim->neg_x, neg_x, PUB_KEY_SIZE);
+  victim->last_used = ++_use_counter;
+  return true;
+}
+
+bool KeyPointCache::verify(const Identity& id, const uint8_t* sig, const uint8_t* message, int msg_len) {
+  uint8_t neg_x[PUB_KEY_SIZE];
+  return lookup(id.pub_key, neg_x) && id.verify(sig, message, msg_len, neg_x);
+}
+#endif
+
 bool Identity::readFrom(Stream& s) {
   return (s.readBytes(pub_key, PUB_KEY_SIZE) == PUB_KEY_SIZE);
 }
@@ -96,4 +145,41 @@ void LocalIdentity::calcSharedSecret(uint8_t* secret, const uint8_t* other_pub_k
   ed25519_key_exchange(secret, other_pub_key, prv_key);
 }
 
-}
\ No newline at end of file
+#if SHARED_SECRET_CACHE_SIZE
+void SharedSecretCache::clear() {
+  memset(_entries, 0, sizeof(_entries));
+  _use_counter = 0;
+}
+
+SharedSecretCache::Entry* SharedSecretCache::lookup(const uint8_t* pub_key) {
+  for (int i = 0; i < SHARED_SECRET_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->last_used && memcmp(e->pub_key, pub_key, PUB_KEY_SIZE) == 0) {
+      e->last_used = ++_use_counter;
+      return e;
+    }
+  }
+  return NULL;
+}
+
+SharedSecretCache::Entry* SharedSecretCache::insert(const LocalIdentity& self_id, const uint8_t* pub_key) {
+  Entry* victim = &_entries[0];
+  for (int i = 1; i < SHARED_SECRET_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (victim->verified ? (!e->verified || e->last_used < victim->last_used)
+                         : (!e->verified && e->last_used < victim->last_used)) {
+      victim = e;   // unused, or least recently used (unverified before verified)
+    }
+  }
+
+  memcpy(victim->pub_key, pub_key, PUB_KEY_SIZE);
+  self_id.calcSharedSecret(victim->secret, pub_key);
+  victim->last_used = ++_use_counter;
+  victim->window_start = 0;
+  victim->num_reqs = 0;
+  victim->verified = false;
+  return victim;
+}
+#endif
+
+}
@@ -23,6 +23,13 @@ public:
   bool isHashMatch(const uint8_t* hash) const {
     return memcmp(hash, pub_key, PATH_HASH_SIZE) == 0;
   }
+  int copyHashTo(uint8_t* dest, uint8_t hash_size) const {
+    memcpy(dest, pub_key, hash_size);
+    return hash_size;
+  }
+  bool isHashMatch(const uint8_t* hash, uint8_t hash_size) const {
+    return memcmp(hash, pub_key, hash_size) == 0;
+  }
 
   /**
    * \brief  Performs Ed25519 signature verification.
@@ -33,6 +40,22 @@ public:
   */
   bool verify(const uint8_t* sig, const uint8_t* message, int msg_len) const;
 
+  /**
+   * \brief  As above, but with this public key already decompressed (see KeyPointCache), which saves a field exponentiation.
+   * \param neg_x IN - from KeyPointCache::lookup() (must be PUB_KEY_SIZE bytes)
+  */
+  bool verify(const uint8_t* sig, const uint8_t* message, int msg_len, const uint8_t* neg_x) const;
+
+  /**
+   * \brief  Verifies several Ed25519 signatures together, which is much quicker than one by one.
+   * \param count  number of signatures, up to ED25519_BATCH_MAX
+   * \param rng  source of the random multipliers (so a forger can't craft signatures which cancel out)
+   * \param neg_xs  (optional) decompressed forms of 'pub_keys', from KeyPointCache::lookup(). Entries can be NULL.
+   * \returns true, if ALL signatures are valid. Otherwise, use verify() on each to find which are not.
+  */
+  static bool verifyBatch(int count, const uint8_t* const sigs[], const uint8_t* const pub_keys[], const uint8_t* const messages[], const int msg_lens[], RNG* rng,
+                          const uint8_t* const neg_xs[]=NULL);
+
   bool matches(const Identity& other) const { return memcmp(pub_key, other.pub_key, PUB_KEY_SIZE) == 0; }
   bool matches(const uint8_t* other_pubkey) const { return memcmp(pub_key, other_pubkey, PUB_KEY_SIZE) == 0; }
 
@@ -41,6 +64,40 @@ public:
   void printTo(Stream& s) const;
 };
 
+#ifndef KEY_POINT_CACHE_SIZE
+  #define KEY_POINT_CACHE_SIZE    0    // zero to disable (costs 68 bytes of RAM per entry)
+                                       // NOTE: non-zero verifies adverts with lib/ed25519, not rweather (see Identity::verify())
+#endif
+
+#if KEY_POINT_CACHE_SIZE
+/**
+ * \brief  Remembers the decompressed public keys (ie. curve points) of the most recently verified identities, so that
+ *         their later signatures (eg. periodic adverts) don't need the costly square root each time.
+*/
+class KeyPointCache {
+  struct Entry {
+    uint8_t pub_key[PUB_KEY_SIZE];
+    uint8_t neg_x[PUB_KEY_SIZE];   // negated x coordinate (y is in pub_key)
+    uint32_t last_used;            // zero if slot unused
+  };
+  Entry _entries[KEY_POINT_CACHE_SIZE];
+  uint32_t _use_counter;
+
+public:
+  KeyPointCache() { clear(); }
+
+  void clear();
+
+  /**
+   * \param  neg_x  OUT - the decompressed form of 'pub_key' (PUB_KEY_SIZE bytes)
+   * \returns  false if 'pub_key' is not a valid point
+  */
+  bool lookup(const uint8_t* pub_key, uint8_t* neg_x);
+
+  bool verify(const Identity& id, const uint8_t* sig, const uint8_t* message, int msg_len);
+};
+#endif
+
 /**
  * \brief  An Identity generated on THIS device, ie. with public/private Ed25519 key pair being on this device.
 */
@@ -80,5 +137,46 @@ public:
   void readFrom(const uint8_t* src, size_t len);
 };
 
+#ifndef SHARED_SECRET_CACHE_SIZE
+  #define SHARED_SECRET_CACHE_SIZE   8    // zero to disable (costs 76 bytes of RAM per entry)
+#endif
+
+#if SHARED_SECRET_CACHE_SIZE
+/**
+ * \brief  Remembers the ECDH shared secrets with the most recent senders of anonymous requests (eg. logins),
+ *         so repeated requests don't need the costly key exchange each time.
+*/
+class SharedSecretCache {
+public:
+  struct Entry {
+    uint8_t pub_key[PUB_KEY_SIZE];
+    uint8_t secret[PUB_KEY_SIZE];
+    uint32_t last_used;            // zero if slot unused
+    unsigned long window_start;    // for the app's rate limiting
+    uint8_t num_reqs;              // .. authenticated requests since window_start
+    bool verified;                 // secret has authenticated a packet, ie. not a forged sender
+  };
+
+  SharedSecretCache() { clear(); }
+
+  void clear();
+
+  /**
+   * \returns  the entry for 'pub_key', or NULL if not cached
+  */
+  Entry* lookup(const uint8_t* pub_key);
+
+  /**
+   * \brief  calculates the secret between 'self_id' and 'pub_key', and caches it. Evicts unverified entries first,
+   *         so a flood of forged senders can't push out the genuine ones.
+  */
+  Entry* insert(const LocalIdentity& self_id, const uint8_t* pub_key);
+
+private:
+  Entry _entries[SHARED_SECRET_CACHE_SIZE];
+  uint32_t _use_counter;
+};
+#endif
+
 }
 
@@ -5,10 +5,23 @@ namespace mesh {
 
 void Mesh::begin() {
   Dispatcher::begin();
+#if SHARED_SECRET_CACHE_SIZE
+  _anon_secrets.clear();   // self_id may have been (re)loaded
+#endif
 }
 
 void Mesh::loop() {
+#if MESH_STACK_STATS
+  uint8_t marker;
+  _stack_base = (uintptr_t) &marker;
+#endif
   Dispatcher::loop();
+
+#if ADVERT_BATCH_SIZE
+  if (_num_pending_adverts > 0 && millisHasNowPassed(_advert_batch_due)) {
+    verifyPendingAdverts();
+  }
+#endif
 }
 
 bool Mesh::allowPacketForward(const mesh::Packet* packet) { 
@@ -22,7 +35,7 @@ uint32_t Mesh::getRetransmitDelay(const mesh::Packet* packet) {
 uint32_t Mesh::getDirectRetransmitDelay(const Packet* packet) {
   return 0;  // by default, no delay
 }
-uint8_t Mesh::getExtraAckTransmitCount() const {
+uint8_t Mesh::getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size) {
   return 0;
 }
 
@@ -30,7 +43,7 @@ uint32_t Mesh::getCADFailRetryDelay() const {
   return _rng->nextInt(1, 4)*120;
 }
 
-int Mesh::searchPeersByHash(const uint8_t* hash) {
+int Mesh::searchPeersByHash(const uint8_t* hash, uint8_t hash_size) {
   return 0;  // not found
 }
 
@@ -38,11 +51,25 @@ int Mesh::searchChannelsByHash(const uint8_t* hash, GroupChannel channels[], int
   return 0;  // not found
 }
 
+static bool isSupportedV2Type(uint8_t type) {
+  // NOTE: group and TRACE packets are V1 only, and V2 adverts are the compact form
+  return type == PAYLOAD_TYPE_ADVERT || type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE || type == PAYLOAD_TYPE_TXT_MSG || type == PAYLOAD_TYPE_PATH
+      || type == PAYLOAD_TYPE_ANON_REQ || type == PAYLOAD_TYPE_ACK || type == PAYLOAD_TYPE_MULTIPART || type == PAYLOAD_TYPE_RAW_CUSTOM
+      || type == PAYLOAD_TYPE_ACK_BUNDLE;
+}
+
 DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
-  if (pkt->getPayloadVer() > PAYLOAD_VER_1) {  // not supported in this firmware version
+  if (pkt->getPayloadVer() > PAYLOAD_VER_2 || (pkt->getPayloadVer() == PAYLOAD_VER_2 && !isSupportedV2Type(pkt->getPayloadType()))) {
+    // not supported in this firmware version
     MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): unsupported packet version", getLogDateTime());
     return ACTION_RELEASE;
   }
+  uint8_t hash_size = pkt->getPathHashSize();
+  uint8_t mac_size = pkt->getMACSize();
+
+  if (pkt->isRouteFlood()) {
+    checkFloodSuppression(pkt);   // could be a neighbour re-transmitting something we're about to
+  }
 
   if (pkt->isRouteDirect() && pkt->getPayloadType() == PAYLOAD_TYPE_TRACE) {
     if (pkt->path_len < MAX_PATH_SIZE) {
@@ -68,8 +95,8 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
     return ACTION_RELEASE;
   }
 
-  if (pkt->isRouteDirect() && pkt->path_len >= PATH_HASH_SIZE) {
-    if (self_id.isHashMatch(pkt->path) && allowPacketForward(pkt)) {
+  if (pkt->isRouteDirect() && pkt->path_len >= hash_size) {
+    if (self_id.isHashMatch(pkt->path, hash_size) && allowPacketForward(pkt)) {
       if (pkt->getPayloadType() == PAYLOAD_TYPE_MULTIPART) {
         return forwardMultipartDirect(pkt);
       } else if (pkt->getPayloadType() == PAYLOAD_TYPE_ACK) {
@@ -87,6 +114,27 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
         return ACTION_RETRANSMIT_DELAYED(0, d);  // Routed traffic is HIGHEST priority 
       }
     }
+    bool upstream = false;   // ie. we are still further along its remaining path
+    for (int i = 0; i + hash_size <= pkt->path_len && !upstream; i += hash_size) {
+      upstream = self_id.isHashMatch(&pkt->path[i], hash_size);
+    }
+    if (!upstream) {
+      // if another node is forwarding an ACK (and we're not on its remaining path), it has got past us.
+      // Any extra copies we still have queued are now redundant
+      uint32_t ack_crc;
+      if (pkt->getPayloadType() == PAYLOAD_TYPE_ACK && pkt->payload_len >= 4) {
+        memcpy(&ack_crc, pkt->payload, 4);
+        cancelOutboundByAck(ack_crc);
+      } else if (pkt->getPayloadType() == PAYLOAD_TYPE_MULTIPART && pkt->payload_len >= 5 && (pkt->payload[0] & 0x0F) == PAYLOAD_TYPE_ACK) {
+        memcpy(&ack_crc, &pkt->payload[1], 4);
+        cancelOutboundByAck(ack_crc);
+      } else if (pkt->getPayloadType() == PAYLOAD_TYPE_ACK_BUNDLE) {
+        for (int i = 0; i + 4 <= pkt->payload_len; i += 4) {
+          memcpy(&ack_crc, &pkt->payload[i], 4);
+          cancelOutboundByAck(ack_crc);
+        }
+      }
+    }
     return ACTION_RELEASE;   // this node is NOT the next hop (OR this packet has already been forwarded), so discard.
   }
 
@@ -105,46 +153,65 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       }
       break;
     }
+    case PAYLOAD_TYPE_ACK_BUNDLE: {
+      if (pkt->payload_len < 4) {
+        MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete ACK bundle", getLogDateTime());
+      } else if (pkt->isRouteDirect() && !_tables->hasSeen(pkt)) {
+        for (int i = 0; i + 4 <= pkt->payload_len; i += 4) {
+          uint32_t ack_crc;
+          memcpy(&ack_crc, &pkt->payload[i], 4);
+          onAckRecv(pkt, ack_crc);
+        }
+        // NOTE: bundles are only sent DIRECT, so never flood routed
+      }
+      break;
+    }
     case PAYLOAD_TYPE_PATH:
     case PAYLOAD_TYPE_REQ:
     case PAYLOAD_TYPE_RESPONSE:
     case PAYLOAD_TYPE_TXT_MSG: {
       int i = 0;
-      uint8_t dest_hash = pkt->payload[i++];
-      uint8_t src_hash = pkt->payload[i++];
+      const uint8_t* dest_hash = &pkt->payload[i]; i += hash_size;
+      const uint8_t* src_hash = &pkt->payload[i]; i += hash_size;
 
       uint8_t* macAndData = &pkt->payload[i];   // MAC + encrypted data 
-      if (i + CIPHER_MAC_SIZE >= pkt->payload_len) {
+      if (i + mac_size >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
       } else if (!_tables->hasSeen(pkt)) {
+        if (pkt->isRouteFlood()) onFloodPathRecv(src_hash, pkt);
+
         // NOTE: this is a 'first packet wins' impl. When receiving from multiple paths, the first to arrive wins.
         //       For flood mode, the path may not be the 'best' in terms of hops.
         // FUTURE: could send back multiple paths, using createPathReturn(), and let sender choose which to use(?)
 
-        if (self_id.isHashMatch(&dest_hash)) {
+        if (self_id.isHashMatch(dest_hash, hash_size)) {
           // scan contacts DB, for all matching hashes of 'src_hash' (max 4 matches supported ATM)
-          int num = searchPeersByHash(&src_hash);
+          int num = searchPeersByHash(src_hash, hash_size);
           // for each matching contact, try to decrypt data
           bool found = false;
+          uint8_t* secret = _ws.secret;
+          uint8_t* data = _ws.data;
           for (int j = 0; j < num; j++) {
-            uint8_t secret[PUB_KEY_SIZE];
             getPeerSharedSecret(secret, j);
+            const HMACState* hmac = getPeerHMACState(j);
 
             // decrypt, checking MAC is valid
-            uint8_t data[MAX_PACKET_PAYLOAD];
-            int len = Utils::MACThenDecrypt(secret, data, macAndData, pkt->payload_len - i);
+            int len = _crypto.MACThenDecrypt(hmac, secret, data, macAndData, pkt->payload_len - i, mac_size);
             if (len > 0) {  // success!
+              sampleStack();
               if (pkt->getPayloadType() == PAYLOAD_TYPE_PATH) {
                 int k = 0;
                 uint8_t path_len = data[k++];
                 uint8_t* path = &data[k]; k += path_len;
-                uint8_t extra_type = data[k++] & 0x0F;   // upper 4 bits reserved for future use
+                uint8_t max_ver = data[k] >> PATH_EXTRA_MAX_VER_SHIFT;   // 0 (or 0xF from older firmware) means V1 only
+                uint8_t extra_type = data[k++] & 0x0F;
                 uint8_t* extra = &data[k];
                 uint8_t extra_len = len - k;   // remainder of packet (may be padded with zeroes!)
+                onPeerPayloadVerRecv(j, max_ver > PAYLOAD_VER_4 ? PAYLOAD_VER_1 : max_ver);
                 if (onPeerPathRecv(pkt, j, secret, path, path_len, extra_type, extra, extra_len)) {
                   if (pkt->isRouteFlood()) {
                     // send a reciprocal return path to sender, but send DIRECTLY!
-                    mesh::Packet* rpath = createPathReturn(&src_hash, secret, pkt->path, pkt->path_len, 0, NULL, 0);
+                    mesh::Packet* rpath = createPathReturn(src_hash, secret, pkt->path, pkt->path_len, 0, NULL, 0, pkt->getPayloadVer());
                     if (rpath) sendDirect(rpath, path, path_len, 500);
                   }
                 }
@@ -158,7 +225,7 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
           if (found) {
             pkt->markDoNotRetransmit();  // packet was for this node, so don't retransmit
           } else {
-            MESH_DEBUG_PRINTLN("%s recv matches no peers, src_hash=%02X", getLogDateTime(), (uint32_t)src_hash);
+            MESH_DEBUG_PRINTLN("%s recv matches no peers, src_hash=%02X", getLogDateTime(), (uint32_t)src_hash[0]);
           }
         }
         action = routeRecvPacket(pkt);
@@ -167,25 +234,37 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
     }
     case PAYLOAD_TYPE_ANON_REQ: {
       int i = 0;
-      uint8_t dest_hash = pkt->payload[i++];
+      const uint8_t* dest_hash = &pkt->payload[i]; i += hash_size;
       uint8_t* sender_pub_key = &pkt->payload[i]; i += PUB_KEY_SIZE;
 
       uint8_t* macAndData = &pkt->payload[i];   // MAC + encrypted data 
-      if (i + 2 >= pkt->payload_len) {
+      if (i + mac_size >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
       } else if (!_tables->hasSeen(pkt)) {
-        if (self_id.isHashMatch(&dest_hash)) {
-          Identity sender(sender_pub_key);
+        if (pkt->isRouteFlood()) onFloodPathRecv(sender_pub_key, pkt);
 
-          uint8_t secret[PUB_KEY_SIZE];
-          self_id.calcSharedSecret(secret, sender);
+        if (self_id.isHashMatch(dest_hash, hash_size)) {
+          Identity sender(sender_pub_key);
 
-          // decrypt, checking MAC is valid
-          uint8_t data[MAX_PACKET_PAYLOAD];
-          int len = Utils::MACThenDecrypt(secret, data, macAndData, pkt->payload_len - i);
-          if (len > 0) {  // success!
-            onAnonDataRecv(pkt, secret, sender, data, len);
-            pkt->markDoNotRetransmit();
+          uint8_t* secret = _ws.secret;
+          if (getAnonSecret(secret, sender_pub_key)) {
+            // decrypt, checking MAC is valid
+            uint8_t* data = _ws.data;
+            int len = _crypto.MACThenDecrypt(NULL, secret, data, macAndData, pkt->payload_len - i, mac_size);
+            if (len > 0) {  // success!
+              sampleStack();
+#if SHARED_SECRET_CACHE_SIZE
+              auto e = _anon_secrets.lookup(sender_pub_key);
+              if (e) {   // only count authenticated requests, so forged ones can't use up the sender's quota
+                e->verified = true;
+                e->num_reqs++;
+              }
+#endif
+              onAnonDataRecv(pkt, secret, sender, data, len);
+              pkt->markDoNotRetransmit();
+            }
+          } else {
+            MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): ANON_REQ rate limited", getLogDateTime());
           }
         }
         action = routeRecvPacket(pkt);
@@ -201,15 +280,16 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       if (i + 2 >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
       } else if (!_tables->hasSeen(pkt)) {
-        // scan channels DB, for all matching hashes of 'channel_hash' (max 2 matches supported ATM)
-        GroupChannel channels[2];
-        int num = searchChannelsByHash(&channel_hash, channels, 2);
+        // scan channels DB, for all matching hashes of 'channel_hash'
+        GroupChannel* channels = _ws.channels;
+        int num = searchChannelsByHash(&channel_hash, channels, MAX_CHANNEL_HASH_MATCHES);
         // for each matching channel, try to decrypt data
+        uint8_t* data = _ws.data;
         for (int j = 0; j < num; j++) {
-          // decrypt, checking MAC is valid
-          uint8_t data[MAX_PACKET_PAYLOAD];
-          int len = Utils::MACThenDecrypt(channels[j].secret, data, macAndData, pkt->payload_len - i);
+          // decrypt, checking MAC is valid (with the channel's pre-computed HMAC state, before any AES work)
+          int len = _crypto.MACThenDecrypt(&channels[j].hmac_state, channels[j].secret, data, macAndData, pkt->payload_len - i);
           if (len > 0) {  // success!
+            sampleStack();
             onGroupDataRecv(pkt, pkt->getPayloadType(), channels[j], data, len);
             break;
           }
@@ -219,41 +299,34 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       break;
     }
     case PAYLOAD_TYPE_ADVERT: {
-      int i = 0;
-      Identity id;
-      memcpy(id.pub_key, &pkt->payload[i], PUB_KEY_SIZE); i += PUB_KEY_SIZE;
-
-      uint32_t timestamp;
-      memcpy(&timestamp, &pkt->payload[i], 4); i += 4;
-      const uint8_t* signature = &pkt->payload[i]; i += SIGNATURE_SIZE;
-
-      if (i > pkt->payload_len) {
+      if (pkt->getPayloadVer() == PAYLOAD_VER_2 && !expandCompactAdvert(pkt)) {
+        break;   // sender unknown to us, or a duplicate
+      }
+      if (PUB_KEY_SIZE + 4 + SIGNATURE_SIZE > pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete advertisement packet", getLogDateTime());
-      } else if (self_id.matches(id.pub_key)) {
+      } else if (self_id.matches(pkt->payload)) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): receiving SELF advert packet", getLogDateTime());
       } else if (!_tables->hasSeen(pkt)) {
-        uint8_t* app_data = &pkt->payload[i];
-        int app_data_len = pkt->payload_len - i;
-        if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
-
+#if ADVERT_BATCH_SIZE
+        // hold it, and check signature along with any others arriving soon (eg. after a mass reboot)
+        if (_num_pending_adverts == 0) _advert_batch_due = futureMillis(ADVERT_BATCH_WINDOW_MILLIS);
+        _pending_adverts[_num_pending_adverts++] = pkt;
+        if (_num_pending_adverts >= ADVERT_BATCH_SIZE) verifyPendingAdverts();
+        action = ACTION_MANUAL_HOLD;
+#else
         // check that signature is valid
         bool is_ok;
         {
-          uint8_t message[PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE];
-          int msg_len = 0;
-          memcpy(&message[msg_len], id.pub_key, PUB_KEY_SIZE); msg_len += PUB_KEY_SIZE;
-          memcpy(&message[msg_len], &timestamp, 4); msg_len += 4;
-          memcpy(&message[msg_len], app_data, app_data_len); msg_len += app_data_len;
-
-          is_ok = id.verify(signature, message, msg_len);
+          int msg_len = getAdvertSignedData(pkt, _ws.message);
+          Identity id(pkt->payload);
+          is_ok = verifyAdvert(id, &pkt->payload[PUB_KEY_SIZE + 4], _ws.message, msg_len);
         }
         if (is_ok) {
-          MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): valid advertisement received!", getLogDateTime());
-          onAdvertRecv(pkt, id, timestamp, app_data, app_data_len);
-          action = routeRecvPacket(pkt);
+          action = acceptAdvert(pkt);
         } else {
-          MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): received advertisement with forged signature! (app_data_len=%d)", getLogDateTime(), app_data_len);
+          MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): received advertisement with forged signature! (len=%d)", getLogDateTime(), (uint32_t)pkt->payload_len);
         }
+#endif
       }
       break;
     }
@@ -284,6 +357,11 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
             onAckRecv(&tmp, ack_crc);
             //action = routeRecvPacket(&tmp);  // NOTE: currently not needed, as multipart ACKs not sent Flood
           }
+        } else if (type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE) {   // part of a larger, encrypted REQ/RESPONSE
+          if (pkt->payload_len > 1 + 2*hash_size + mac_size && !_tables->hasSeen(pkt)) {
+            recvPeerMultipart(pkt);
+            // NOTE: these are not flood routed
+          }
         } else {
           // FUTURE: other multipart types??
         }
@@ -300,31 +378,96 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
 
 void Mesh::removeSelfFromPath(Packet* pkt) {
   // remove our hash from 'path'
-  pkt->path_len -= PATH_HASH_SIZE;
-#if 0
-  memcpy(pkt->path, &pkt->path[PATH_HASH_SIZE], pkt->path_len);
-#elif PATH_HASH_SIZE == 1
-  for (int k = 0; k < pkt->path_len; k++) {  // shuffle bytes by 1
-    pkt->path[k] = pkt->path[k + 1];
-  }
-#else
-  #error "need path remove impl"
-#endif
+  uint8_t hash_size = pkt->getPathHashSize();
+  pkt->path_len -= hash_size;
+  memmove(pkt->path, &pkt->path[hash_size], pkt->path_len);   // shuffle bytes down (regions overlap)
 }
 
 DispatcherAction Mesh::routeRecvPacket(Packet* packet) {
   if (packet->isRouteFlood() && !packet->isMarkedDoNotRetransmit()
-    && packet->path_len + PATH_HASH_SIZE <= MAX_PATH_SIZE && allowPacketForward(packet)) {
+    && packet->path_len + packet->getPathHashSize() <= MAX_PATH_SIZE && allowPacketForward(packet)) {
+    if (convertFloodToDirect(packet)) {
+      uint32_t d = getDirectRetransmitDelay(packet);
+      return ACTION_RETRANSMIT_DELAYED(0, d);
+    }
+
     // append this node's hash to 'path'
-    packet->path_len += self_id.copyHashTo(&packet->path[packet->path_len]);
+    packet->path_len += self_id.copyHashTo(&packet->path[packet->path_len], packet->getPathHashSize());
 
     uint32_t d = getRetransmitDelay(packet);
+    if (getFloodSuppressThreshold(packet) > 0) {
+      // remember it, in case neighbours are heard re-transmitting it before we do
+      auto f = &_pending_floods[_next_pending_flood];
+      _next_pending_flood = (_next_pending_flood + 1) % MAX_PENDING_FLOODS;   // cyclic table
+      f->active = true;
+      packet->calculatePacketHash(f->hash);
+      f->dup_count = 0;
+      f->scheduled_for = futureMillis(d);
+    }
     // as this propagates outwards, give it lower and lower priority
     return ACTION_RETRANSMIT_DELAYED(packet->path_len, d);   // give priority to closer sources, than ones further away
   }
   return ACTION_RELEASE;
 }
 
+bool Mesh::convertFloodToDirect(Packet* packet) {
+  if ((packet->header & PH_ROUTE_MASK) != ROUTE_TYPE_FLOOD) return false;   // NOTE: not for floods with transport codes
+
+  // NOTE: a flood REQ, TXT_MSG or ANON_REQ makes the destination send a PATH return, and a flood PATH makes it send a
+  //   reciprocal one. Arriving DIRECT, they wouldn't, so neither end would learn a direct path (and would keep flooding)
+  if (packet->getPayloadType() != PAYLOAD_TYPE_RESPONSE) return false;
+
+  uint8_t hash_size = packet->getPathHashSize();
+  if (packet->payload_len < hash_size) return false;
+
+  uint8_t path[MAX_PATH_SIZE];
+  int path_len = getDirectRouteFor(packet->payload, packet, path);
+  if (path_len < 0 || path_len > MAX_PATH_SIZE) return false;   // no known route, so keep flooding
+
+  for (int i = 0; i < path_len; i += hash_size) {
+    if (self_id.isHashMatch(&path[i], hash_size)) return false;   // route would loop back through here
+  }
+
+  packet->header = (packet->header & ~PH_ROUTE_MASK) | ROUTE_TYPE_DIRECT;
+  memcpy(packet->path, path, path_len);
+  packet->path_len = path_len;
+  n_flood_direct_routed++;
+
+  MESH_DEBUG_PRINTLN("%s Mesh::routeRecvPacket(): flood re-routed DIRECT, path_len=%d", getLogDateTime(), (uint32_t) path_len);
+  return true;
+}
+
+void Mesh::checkFloodSuppression(const Packet* pkt) {
+  PendingFlood* f = NULL;
+  bool hashed = false;
+  uint8_t hash[MAX_HASH_SIZE];
+  for (int i = 0; i < MAX_PENDING_FLOODS && f == NULL; i++) {
+    auto p = &_pending_floods[i];
+    if (!p->active) continue;
+    if (millisHasNowPassed(p->scheduled_for)) {   // already sent
+      p->active = false;
+      continue;
+    }
+
+    if (!hashed) {   // only calc hash when something is actually pending
+      pkt->calculatePacketHash(hash);
+      hashed = true;
+    }
+    if (memcmp(hash, p->hash, MAX_HASH_SIZE) == 0) f = p;
+  }
+  if (f == NULL) return;   // not one we are about to re-transmit
+
+  uint8_t threshold = getFloodSuppressThreshold(pkt);
+  if (threshold == 0 || ++f->dup_count < threshold) return;
+
+  // enough neighbours have covered this, so cancel our re-transmit (if still queued)
+  if (cancelOutboundByHash(f->hash) > 0) {
+    n_flood_suppressed++;
+    MESH_DEBUG_PRINTLN("%s Mesh::checkFloodSuppression(): re-transmit cancelled, dups=%d", getLogDateTime(), (uint32_t) f->dup_count);
+  }
+  f->active = false;
+}
+
 DispatcherAction Mesh::forwardMultipartDirect(Packet* pkt) {
   uint8_t remaining = pkt->payload[0] >> 4;  // num of packets in this multipart sequence still to be sent
   uint8_t type = pkt->payload[0] & 0x0F;
@@ -341,19 +484,51 @@ DispatcherAction Mesh::forwardMultipartDirect(Packet* pkt) {
       removeSelfFromPath(&tmp);
       routeDirectRecvAcks(&tmp, ((uint32_t)remaining + 1) * 300);  // expect multipart ACKs 300ms apart (x2)
     }
+  } else if (type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE) {   // part of a larger REQ/RESPONSE, forward as normal
+    if (!_tables->hasSeen(pkt)) {
+      removeSelfFromPath(pkt);
+
+      uint32_t d = getDirectRetransmitDelay(pkt);
+      return ACTION_RETRANSMIT_DELAYED(0, d);
+    }
   }
   return ACTION_RELEASE;
 }
 
+void Mesh::recvPeerMultipart(Packet* pkt) {
+  uint8_t hash_size = pkt->getPathHashSize();
+  int i = 1;   // skip the multipart header byte
+  const uint8_t* dest_hash = &pkt->payload[i]; i += hash_size;
+  const uint8_t* src_hash = &pkt->payload[i]; i += hash_size;
+  if (!self_id.isHashMatch(dest_hash, hash_size)) return;
+
+  int num = searchPeersByHash(src_hash, hash_size);
+  uint8_t* secret = _ws.secret;
+  uint8_t* data = _ws.data;
+  for (int j = 0; j < num; j++) {
+    getPeerSharedSecret(secret, j);
+
+    // decrypt, checking MAC is valid. Multipart header is passed to app as first byte
+    data[0] = pkt->payload[0];
+    int len = _crypto.MACThenDecrypt(getPeerHMACState(j), secret, &data[1], &pkt->payload[i], pkt->payload_len - i, pkt->getMACSize());
+    if (len > 0) {  // success!
+      onPeerDataRecv(pkt, PAYLOAD_TYPE_MULTIPART, j, secret, data, 1 + len);
+      pkt->markDoNotRetransmit();
+      return;
+    }
+  }
+  MESH_DEBUG_PRINTLN("%s recv multipart matches no peers, src_hash=%02X", getLogDateTime(), (uint32_t)src_hash[0]);
+}
+
 void Mesh::routeDirectRecvAcks(Packet* packet, uint32_t delay_millis) {
   if (!packet->isMarkedDoNotRetransmit()) {
     uint32_t crc;
     memcpy(&crc, packet->payload, 4);
 
-    uint8_t extra = getExtraAckTransmitCount();
+    uint8_t extra = getExtraAckTransmitCount(packet->path, packet->path_len, packet->getPathHashSize());
     while (extra > 0) {
       delay_millis += getDirectRetransmitDelay(packet) + 300;
-      auto a1 = createMultiAck(crc, extra);
+      auto a1 = createMultiAck(crc, extra, packet->getPayloadVer());
       if (a1) {
         memcpy(a1->path, packet->path, a1->path_len = packet->path_len);
         a1->header &= ~PH_ROUTE_MASK;
@@ -363,7 +538,7 @@ void Mesh::routeDirectRecvAcks(Packet* packet, uint32_t delay_millis) {
       extra--;
     }
 
-    auto a2 = createAck(crc);
+    auto a2 = createAck(crc, packet->getPayloadVer());
     if (a2) {
       memcpy(a2->path, packet->path, a2->path_len = packet->path_len);
       a2->header &= ~PH_ROUTE_MASK;
@@ -373,6 +548,180 @@ void Mesh::routeDirectRecvAcks(Packet* packet, uint32_t delay_millis) {
   }
 }
 
+int Mesh::getAdvertSignedData(const Packet* pkt, uint8_t* message) const {
+  int app_data_len = pkt->payload_len - (PUB_KEY_SIZE + 4 + SIGNATURE_SIZE);
+  if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
+
+  // ie. pub_key + timestamp + app_data (skipping the signature)
+  memcpy(message, pkt->payload, PUB_KEY_SIZE + 4);
+  memcpy(&message[PUB_KEY_SIZE + 4], &pkt->payload[PUB_KEY_SIZE + 4 + SIGNATURE_SIZE], app_data_len);
+  return PUB_KEY_SIZE + 4 + app_data_len;
+}
+
+DispatcherAction Mesh::acceptAdvert(Packet* pkt) {
+  int i = 0;
+  Identity id;
+  memcpy(id.pub_key, &pkt->payload[i], PUB_KEY_SIZE); i += PUB_KEY_SIZE;
+
+  uint32_t timestamp;
+  memcpy(&timestamp, &pkt->payload[i], 4); i += 4;
+  i += SIGNATURE_SIZE;
+
+  uint8_t* app_data = &pkt->payload[i];
+  int app_data_len = pkt->payload_len - i;
+  if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
+
+  MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): valid advertisement received!", getLogDateTime());
+  if (pkt->isRouteFlood()) onFloodPathRecv(id.pub_key, pkt);
+  onAdvertRecv(pkt, id, timestamp, app_data, app_data_len);
+  return routeRecvPacket(pkt);
+}
+
+void Mesh::verifyPendingAdverts() {
+#if ADVERT_BATCH_SIZE
+  int n = _num_pending_adverts;
+  _num_pending_adverts = 0;
+  if (n == 0) return;
+
+  auto messages = _ws.messages;
+  const uint8_t* msg_ptrs[ADVERT_BATCH_SIZE];
+  const uint8_t* sigs[ADVERT_BATCH_SIZE];
+  const uint8_t* keys[ADVERT_BATCH_SIZE];
+  int msg_lens[ADVERT_BATCH_SIZE];
+  bool all_ok = n > 1;
+#if KEY_POINT_CACHE_SIZE
+  auto points = _ws.points;
+  const uint8_t* point_ptrs[ADVERT_BATCH_SIZE];
+#else
+  const uint8_t* const* point_ptrs = NULL;
+#endif
+  for (int i = 0; i < n; i++) {
+    auto pkt = _pending_adverts[i];
+    msg_lens[i] = getAdvertSignedData(pkt, messages[i]);
+    msg_ptrs[i] = messages[i];
+    keys[i] = pkt->payload;
+    sigs[i] = &pkt->payload[PUB_KEY_SIZE + 4];
+#if KEY_POINT_CACHE_SIZE
+    point_ptrs[i] = points[i];
+    if (!_key_points.lookup(keys[i], points[i])) all_ok = false;   // invalid key
+#endif
+  }
+
+  // if the batch fails, find the forged one(s) the slow way
+  all_ok = all_ok && Identity::verifyBatch(n, sigs, keys, msg_ptrs, msg_lens, _rng, point_ptrs);
+  for (int i = 0; i < n; i++) {
+    auto pkt = _pending_adverts[i];
+    Identity id(keys[i]);
+    if (all_ok || verifyAdvert(id, sigs[i], msg_ptrs[i], msg_lens[i])) {
+      processAction(pkt, acceptAdvert(pkt));
+    } else {
+      MESH_DEBUG_PRINTLN("%s Mesh::verifyPendingAdverts(): received advertisement with forged signature! (len=%d)", getLogDateTime(), (uint32_t)pkt->payload_len);
+      releasePacket(pkt);
+    }
+  }
+#endif
+}
+
+bool Mesh::verifyAdvert(const Identity& id, const uint8_t* sig, const uint8_t* message, int msg_len) {
+#if KEY_POINT_CACHE_SIZE
+  return _key_points.verify(id, sig, message, msg_len);
+#else
+  return id.verify(sig, message, msg_len);
+#endif
+}
+
+void Mesh::sampleStack() {
+#if MESH_STACK_STATS
+  uint8_t marker;
+  uintptr_t sp = (uintptr_t) &marker;
+  if (_stack_base > sp && _stack_base - sp > _max_stack_used) {   // NOTE: assumes stack grows down
+    _max_stack_used = _stack_base - sp;
+    MESH_DEBUG_PRINTLN("%s Mesh::sampleStack(): new max depth %u bytes", getLogDateTime(), _max_stack_used);
+  }
+#endif
+}
+
+uint32_t Mesh::getMaxStackUsed() const {
+#if MESH_STACK_STATS
+  return _max_stack_used;
+#else
+  return 0;
+#endif
+}
+
+bool Mesh::getAnonSecret(uint8_t* secret, const uint8_t* sender_pub_key) {
+  unsigned long now = _ms->getMillis();
+#if SHARED_SECRET_CACHE_SIZE
+  auto e = _anon_secrets.lookup(sender_pub_key);
+  if (e) {
+    if (now - e->window_start >= ANON_REQ_RATE_WINDOW) {
+      e->window_start = now;
+      e->num_reqs = 0;
+    }
+    if (e->num_reqs >= ANON_REQ_MAX_PER_SENDER) {   // NOTE: num_reqs is incremented by caller, once MAC is verified
+      n_anon_limited++;
+      return false;
+    }
+    memcpy(secret, e->secret, PUB_KEY_SIZE);
+    return true;
+  }
+#endif
+
+  // new sender, needs the key exchange. Limit how many per window, so a flood of (forged) senders can't starve the loop
+  if (now - _anon_window_start >= ANON_REQ_RATE_WINDOW) {
+    _anon_window_start = now;
+    _anon_ecdh_count = 0;
+  }
+  if (_anon_ecdh_count >= ANON_ECDH_MAX_PER_WINDOW) {
+    n_anon_limited++;
+    return false;
+  }
+  _anon_ecdh_count++;
+  n_anon_ecdh++;
+
+#if SHARED_SECRET_CACHE_SIZE
+  e = _anon_secrets.insert(self_id, sender_pub_key);
+  e->window_start = now;
+  memcpy(secret, e->secret, PUB_KEY_SIZE);
+#else
+  self_id.calcSharedSecret(secret, sender_pub_key);
+#endif
+  return true;
+}
+
+bool Mesh::expandCompactAdvert(Packet* pkt) {
+  if (!(pkt->isRouteDirect() && pkt->path_len == 0)) {
+    MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): compact advert not zero hop", getLogDateTime());
+    return false;
+  }
+  int hdr_len = ADVERT_KEY_PREFIX_SIZE + 4 + SIGNATURE_SIZE;
+  if (pkt->payload_len < hdr_len) {
+    MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete compact advert", getLogDateTime());
+    return false;
+  }
+  if (_tables->hasSeen(pkt)) return false;
+
+  Identity id;
+  uint8_t app_data[MAX_ADVERT_DATA_SIZE];
+  int app_data_len = resolveCompactAdvert(pkt->payload, &pkt->payload[hdr_len], pkt->payload_len - hdr_len, id, app_data);
+  if (app_data_len < 0 || app_data_len > MAX_ADVERT_DATA_SIZE || memcmp(id.pub_key, pkt->payload, ADVERT_KEY_PREFIX_SIZE) != 0) {
+    MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): unable to resolve compact advert", getLogDateTime());
+    return false;
+  }
+
+  // re-construct the full (V1) advert in place, ie. pub_key | timestamp | signature | app_data
+  uint8_t ts_and_sig[4 + SIGNATURE_SIZE];
+  memcpy(ts_and_sig, &pkt->payload[ADVERT_KEY_PREFIX_SIZE], sizeof(ts_and_sig));
+
+  int len = 0;
+  memcpy(&pkt->payload[len], id.pub_key, PUB_KEY_SIZE); len += PUB_KEY_SIZE;
+  memcpy(&pkt->payload[len], ts_and_sig, sizeof(ts_and_sig)); len += sizeof(ts_and_sig);
+  memcpy(&pkt->payload[len], app_data, app_data_len); len += app_data_len;
+  pkt->payload_len = len;
+  pkt->header = (pkt->header & ~(PH_VER_MASK << PH_VER_SHIFT)) | (PAYLOAD_VER_1 << PH_VER_SHIFT);
+  return true;
+}
+
 Packet* Mesh::createAdvert(const LocalIdentity& id, const uint8_t* app_data, size_t app_data_len) {
   if (app_data_len > MAX_ADVERT_DATA_SIZE) return NULL;
 
@@ -409,15 +758,32 @@ Packet* Mesh::createAdvert(const LocalIdentity& id, const uint8_t* app_data, siz
   return packet;
 }
 
+Packet* Mesh::createCompactAdvert(const LocalIdentity& id, const uint8_t* app_data, size_t app_data_len, const uint8_t* delta, size_t delta_len) {
+  if (app_data_len > MAX_ADVERT_DATA_SIZE || ADVERT_KEY_PREFIX_SIZE + 4 + SIGNATURE_SIZE + delta_len > MAX_PACKET_PAYLOAD) return NULL;
+
+  Packet* packet = createAdvert(id, app_data, app_data_len);   // signed over the full pub_key and app_data
+  if (packet) {
+    packet->header |= (PAYLOAD_VER_2 << PH_VER_SHIFT);
+
+    // pub_key is replaced by prefix, and app_data by delta
+    memmove(&packet->payload[ADVERT_KEY_PREFIX_SIZE], &packet->payload[PUB_KEY_SIZE], 4 + SIGNATURE_SIZE);
+    int len = ADVERT_KEY_PREFIX_SIZE + 4 + SIGNATURE_SIZE;
+    memcpy(&packet->payload[len], delta, delta_len); len += delta_len;
+    packet->payload_len = len;
+  }
+  return packet;
+}
+
 #define MAX_COMBINED_PATH  (MAX_PACKET_PAYLOAD - 2 - CIPHER_BLOCK_SIZE)
 
-Packet* Mesh::createPathReturn(const Identity& dest, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len) {
-  uint8_t dest_hash[PATH_HASH_SIZE];
-  dest.copyHashTo(dest_hash);
-  return createPathReturn(dest_hash, secret, path, path_len, extra_type, extra, extra_len);
+Packet* Mesh::createPathReturn(const Identity& dest, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len, uint8_t ver) {
+  uint8_t dest_hash[MAX_PATH_HASH_SIZE];
+  dest.copyHashTo(dest_hash, Packet::hashSizeFor(ver));
+  return createPathReturn(dest_hash, secret, path, path_len, extra_type, extra, extra_len, ver);
 }
 
-Packet* Mesh::createPathReturn(const uint8_t* dest_hash, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len) {
+Packet* Mesh::createPathReturn(const uint8_t* dest_hash, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len, uint8_t ver) {
+  sampleStack();
   if (path_len + extra_len + 5 > MAX_COMBINED_PATH) return NULL;  // too long!!
 
   Packet* packet = obtainNewPacket();
@@ -426,10 +792,12 @@ Packet* Mesh::createPathReturn(const uint8_t* dest_hash, const uint8_t* secret,
     return NULL;
   }
   packet->header = (PAYLOAD_TYPE_PATH << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);
 
+  uint8_t hash_size = Packet::hashSizeFor(ver);
   int len = 0;
-  memcpy(&packet->payload[len], dest_hash, PATH_HASH_SIZE); len += PATH_HASH_SIZE;  // dest hash
-  len += self_id.copyHashTo(&packet->payload[len]);  // src hash
+  memcpy(&packet->payload[len], dest_hash, hash_size); len += hash_size;  // dest hash
+  len += self_id.copyHashTo(&packet->payload[len], hash_size);  // src hash
 
   {
     int data_len = 0;
@@ -437,16 +805,17 @@ Packet* Mesh::createPathReturn(const uint8_t* dest_hash, const uint8_t* secret,
 
     data[data_len++] = path_len;
     memcpy(&data[data_len], path, path_len); data_len += path_len;
+    // upper 4 bits tell the receiver the highest payload version we support
     if (extra_len > 0) {
-      data[data_len++] = extra_type;
+      data[data_len++] = (PAYLOAD_VER_2 << PATH_EXTRA_MAX_VER_SHIFT) | (extra_type & 0x0F);
       memcpy(&data[data_len], extra, extra_len); data_len += extra_len;
     } else {
       // append a timestamp, or random blob (to make packet_hash unique)
-      data[data_len++] = 0xFF;  // dummy payload type
+      data[data_len++] = (PAYLOAD_VER_2 << PATH_EXTRA_MAX_VER_SHIFT) | 0x0F;  // dummy payload type
       getRNG()->random(&data[data_len], 4); data_len += 4;
     }
 
-    len += Utils::encryptThenMAC(secret, &packet->payload[len], data, data_len);
+    len += _crypto.encryptThenMAC(secret, &packet->payload[len], data, data_len, Packet::macSizeFor(ver));
   }
 
   packet->payload_len = len;
@@ -454,9 +823,12 @@ Packet* Mesh::createPathReturn(const uint8_t* dest_hash, const uint8_t* secret,
   return packet;
 }
 
-Packet* Mesh::createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len) {
+Packet* Mesh::createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len, uint8_t ver) {
+  sampleStack();   // usually called from app callbacks, ie. deep in the receive path
+  uint8_t hash_size = Packet::hashSizeFor(ver);
+  uint8_t mac_size = Packet::macSizeFor(ver);
   if (type == PAYLOAD_TYPE_TXT_MSG || type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE) {
-    if (data_len + CIPHER_MAC_SIZE + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL;
+    if (data_len + 2*hash_size + mac_size + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL;
   } else {
     return NULL;  // invalid type
   }
@@ -467,20 +839,53 @@ Packet* Mesh::createDatagram(uint8_t type, const Identity& dest, const uint8_t*
     return NULL;
   }
   packet->header = (type << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);
+
+  int len = 0;
+  len += dest.copyHashTo(&packet->payload[len], hash_size);  // dest hash
+  len += self_id.copyHashTo(&packet->payload[len], hash_size);  // src hash
+  len += _crypto.encryptThenMAC(secret, &packet->payload[len], data, data_len, mac_size);
+
+  packet->payload_len = len;
+
+  return packet;
+}
+
+Packet* Mesh::createMultipartDatagram(uint8_t mp_header, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len, uint8_t ver) {
+  sampleStack();
+  uint8_t type = mp_header & 0x0F;
+  uint8_t hash_size = Packet::hashSizeFor(ver);
+  uint8_t mac_size = Packet::macSizeFor(ver);
+  if (type == PAYLOAD_TYPE_REQ || type == PAYLOAD_TYPE_RESPONSE) {
+    if (1 + data_len + 2*hash_size + mac_size + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL;
+  } else {
+    return NULL;  // invalid type
+  }
+
+  Packet* packet = obtainNewPacket();
+  if (packet == NULL) {
+    MESH_DEBUG_PRINTLN("%s Mesh::createMultipartDatagram(): error, packet pool empty", getLogDateTime());
+    return NULL;
+  }
+  packet->header = (PAYLOAD_TYPE_MULTIPART << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);
 
   int len = 0;
-  len += dest.copyHashTo(&packet->payload[len]);  // dest hash
-  len += self_id.copyHashTo(&packet->payload[len]);  // src hash
-  len += Utils::encryptThenMAC(secret, &packet->payload[len], data, data_len);
+  packet->payload[len++] = mp_header;
+  len += dest.copyHashTo(&packet->payload[len], hash_size);  // dest hash
+  len += self_id.copyHashTo(&packet->payload[len], hash_size);  // src hash
+  len += _crypto.encryptThenMAC(secret, &packet->payload[len], data, data_len, mac_size);
 
   packet->payload_len = len;
 
   return packet;
 }
 
-Packet* Mesh::createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len) {
+Packet* Mesh::createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len, uint8_t ver) {
+  sampleStack();
+  uint8_t hash_size = Packet::hashSizeFor(ver);
   if (type == PAYLOAD_TYPE_ANON_REQ) {
-    if (data_len + 1 + PUB_KEY_SIZE + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL;
+    if (data_len + hash_size + PUB_KEY_SIZE + Packet::macSizeFor(ver) + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL;
   } else {
     return NULL;  // invalid type
   }
@@ -491,15 +896,16 @@ Packet* Mesh::createAnonDatagram(uint8_t type, const LocalIdentity& sender, cons
     return NULL;
   }
   packet->header = (type << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);
 
   int len = 0;
   if (type == PAYLOAD_TYPE_ANON_REQ) {
-    len += dest.copyHashTo(&packet->payload[len]);  // dest hash
+    len += dest.copyHashTo(&packet->payload[len], hash_size);  // dest hash
     memcpy(&packet->payload[len], sender.pub_key, PUB_KEY_SIZE); len += PUB_KEY_SIZE;  // sender pub_key
   } else {
     // FUTURE:
   }
-  len += Utils::encryptThenMAC(secret, &packet->payload[len], data, data_len);
+  len += _crypto.encryptThenMAC(secret, &packet->payload[len], data, data_len, Packet::macSizeFor(ver));
 
   packet->payload_len = len;
 
@@ -507,6 +913,7 @@ Packet* Mesh::createAnonDatagram(uint8_t type, const LocalIdentity& sender, cons
 }
 
 Packet* Mesh::createGroupDatagram(uint8_t type, const GroupChannel& channel, const uint8_t* data, size_t data_len) {
+  sampleStack();
   if (!(type == PAYLOAD_TYPE_GRP_TXT || type == PAYLOAD_TYPE_GRP_DATA)) return NULL;   // invalid type
   if (data_len + 1 + CIPHER_BLOCK_SIZE-1 > MAX_PACKET_PAYLOAD) return NULL; // too long
 
@@ -519,20 +926,21 @@ Packet* Mesh::createGroupDatagram(uint8_t type, const GroupChannel& channel, con
 
   int len = 0;
   memcpy(&packet->payload[len], channel.hash, PATH_HASH_SIZE); len += PATH_HASH_SIZE;
-  len += Utils::encryptThenMAC(channel.secret, &packet->payload[len], data, data_len);
+  len += _crypto.encryptThenMAC(channel.secret, &packet->payload[len], data, data_len);
 
   packet->payload_len = len;
 
   return packet;
 }
 
-Packet* Mesh::createAck(uint32_t ack_crc) {
+Packet* Mesh::createAck(uint32_t ack_crc, uint8_t ver) {
   Packet* packet = obtainNewPacket();
   if (packet == NULL) {
     MESH_DEBUG_PRINTLN("%s Mesh::createAck(): error, packet pool empty", getLogDateTime());
     return NULL;
   }
   packet->header = (PAYLOAD_TYPE_ACK << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);   // only affects the path hash size
 
   memcpy(packet->payload, &ack_crc, 4);
   packet->payload_len = 4;
@@ -540,13 +948,14 @@ Packet* Mesh::createAck(uint32_t ack_crc) {
   return packet;
 }
 
-Packet* Mesh::createMultiAck(uint32_t ack_crc, uint8_t remaining) {
+Packet* Mesh::createMultiAck(uint32_t ack_crc, uint8_t remaining, uint8_t ver) {
   Packet* packet = obtainNewPacket();
   if (packet == NULL) {
     MESH_DEBUG_PRINTLN("%s Mesh::createMultiAck(): error, packet pool empty", getLogDateTime());
     return NULL;
   }
   packet->header = (PAYLOAD_TYPE_MULTIPART << PH_TYPE_SHIFT);  // ROUTE_TYPE_* set later
+  packet->setPayloadVer(ver);   // only affects the path hash size
 
   packet->payload[0] = (remaining << 4) | PAYLOAD_TYPE_ACK;
   memcpy(&packet->payload[1], &ack_crc, 4);
@@ -634,6 +1043,35 @@ void Mesh::sendDirect(Packet* packet, const uint8_t* path, uint8_t path_len, uin
   sendPacket(packet, pri, delay_millis);
 }
 
+bool Mesh::appendToQueuedAck(uint32_t ack_crc, const uint8_t* path, uint8_t path_len, uint8_t ver) {
+  int n = _mgr->getOutboundCount(0xFFFFFFFF);
+  for (int i = 0; i < n; i++) {
+    Packet* pkt = _mgr->getOutboundByIdx(i);
+    if (!pkt->_can_bundle || pkt->getPayloadVer() != ver || pkt->path_len != path_len || memcmp(pkt->path, path, path_len) != 0) continue;
+    if (pkt->payload_len + 4 > ACK_BUNDLE_MAX*4) continue;   // full
+
+    pkt->header = (pkt->header & ~(PH_TYPE_MASK << PH_TYPE_SHIFT)) | (PAYLOAD_TYPE_ACK_BUNDLE << PH_TYPE_SHIFT);
+    memcpy(&pkt->payload[pkt->payload_len], &ack_crc, 4);
+    pkt->payload_len += 4;
+    _tables->hasSeen(pkt);   // mark new packet hash as already sent
+    return true;
+  }
+  return false;  // no suitable ACK queued
+}
+
+void Mesh::sendDirectAck(uint32_t ack_crc, const uint8_t* path, uint8_t path_len, uint32_t delay_millis, uint8_t ver, bool can_bundle) {
+  if (can_bundle && appendToQueuedAck(ack_crc, path, path_len, ver)) return;
+
+  Packet* ack = createAck(ack_crc, ver);
+  if (ack) {
+    if (can_bundle) {
+      ack->_can_bundle = true;
+      if (delay_millis < ACK_BUNDLE_HOLD_MILLIS) delay_millis = ACK_BUNDLE_HOLD_MILLIS;
+    }
+    sendDirect(ack, path, path_len, delay_millis);
+  }
+}
+
 void Mesh::sendZeroHop(Packet* packet, uint32_t delay_millis) {
   packet->header &= ~PH_ROUTE_MASK;
   packet->header |= ROUTE_TYPE_DIRECT;
@@ -1,6 +1,50 @@
 #pragma once
 
 #include <Dispatcher.h>
+#include <CryptoContext.h>
+
+#define PATH_EXTRA_MAX_VER_SHIFT   4   // upper 4 bits of 'extra_type' in PATH packets: highest PAYLOAD_VER_* sender supports
+
+#ifndef MAX_PENDING_FLOODS
+  #define MAX_PENDING_FLOODS   8
+#endif
+
+#ifndef ACK_BUNDLE_MAX
+  #define ACK_BUNDLE_MAX          8     // max ACK CRCs in one PAYLOAD_TYPE_ACK_BUNDLE
+#endif
+
+#ifndef ADVERT_BATCH_SIZE
+  #define ADVERT_BATCH_SIZE       0     // max adverts to verify together, zero to disable (costs about 1.8KB of RAM per advert)
+                                        // NOTE: non-zero verifies adverts with lib/ed25519, not rweather (see Identity::verify())
+#endif
+
+#ifndef ADVERT_BATCH_WINDOW_MILLIS
+  #define ADVERT_BATCH_WINDOW_MILLIS  300   // max time an advert waits for others to join its batch
+#endif
+
+#ifndef MAX_CHANNEL_HASH_MATCHES
+  #define MAX_CHANNEL_HASH_MATCHES      4   // max channels (with same hash) a group packet is tried against
+#endif
+
+#ifndef ANON_REQ_RATE_WINDOW
+  #define ANON_REQ_RATE_WINDOW      10000   // millis, period of the ANON_REQ limits below
+#endif
+
+#ifndef ANON_ECDH_MAX_PER_WINDOW
+  #define ANON_ECDH_MAX_PER_WINDOW     16   // max key exchanges with new (ie. uncached) ANON_REQ senders
+#endif
+
+#ifndef ANON_REQ_MAX_PER_SENDER
+  #define ANON_REQ_MAX_PER_SENDER       8   // max ANON_REQs accepted (ie. MAC verified) from any one (cached) sender
+#endif
+
+#ifndef MESH_STACK_STATS
+  #define MESH_STACK_STATS              0   // track max stack depth below Mesh::loop() (see Mesh::getMaxStackUsed())
+#endif
+
+#ifndef ACK_BUNDLE_HOLD_MILLIS
+  #define ACK_BUNDLE_HOLD_MILLIS  400   // min time a bundle-able ACK is held in outbound queue, so others can join it
+#endif
 
 namespace mesh {
 
@@ -8,6 +52,25 @@ class GroupChannel {
 public:
   uint8_t hash[PATH_HASH_SIZE];
   uint8_t secret[PUB_KEY_SIZE];
+  HMACState hmac_state;   // pre-computed from 'secret'
+};
+
+/**
+ * \brief  Scratch buffers of the receive path. Kept per Mesh, rather than on the stack in onRecvPacket(), so they
+ *         don't add to the stack depth of the app callbacks made from there.
+ *         NOTE: 'data' and 'secret' are passed to those callbacks, so are only valid until they return.
+*/
+struct RecvWorkspace {
+  uint8_t data[MAX_PACKET_PAYLOAD];   // decrypted payload
+  uint8_t secret[PUB_KEY_SIZE];       // of the peer being tried
+  GroupChannel channels[MAX_CHANNEL_HASH_MATCHES];
+  uint8_t message[PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE];   // the signed part of an advert
+#if ADVERT_BATCH_SIZE
+  uint8_t messages[ADVERT_BATCH_SIZE][PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE];
+#if KEY_POINT_CACHE_SIZE
+  uint8_t points[ADVERT_BATCH_SIZE][PUB_KEY_SIZE];
+#endif
+#endif
 };
 
 /**
@@ -27,11 +90,53 @@ class Mesh : public Dispatcher {
   RTCClock* _rtc;
   RNG* _rng;
   MeshTables* _tables;
+  CryptoContext _crypto;
+  RecvWorkspace _ws;
+#if MESH_STACK_STATS
+  uintptr_t _stack_base;    // at loop() entry
+  uint32_t _max_stack_used;
+#endif
+
+  struct PendingFlood {
+    bool active;
+    uint8_t hash[MAX_HASH_SIZE];    // of our queued re-transmit
+    uint8_t dup_count;   // num of neighbours heard re-transmitting it, since queued
+    unsigned long scheduled_for;   // entry is stale after this
+  };
+  PendingFlood _pending_floods[MAX_PENDING_FLOODS];
+  int _next_pending_flood;
+  uint32_t n_flood_suppressed;
+  uint32_t n_flood_direct_routed;
+#if ADVERT_BATCH_SIZE
+  Packet* _pending_adverts[ADVERT_BATCH_SIZE];   // waiting for signature verification
+  int _num_pending_adverts;
+  unsigned long _advert_batch_due;
+#endif
+#if KEY_POINT_CACHE_SIZE
+  KeyPointCache _key_points;   // of recent advert senders
+#endif
+#if SHARED_SECRET_CACHE_SIZE
+  SharedSecretCache _anon_secrets;   // of recent ANON_REQ senders
+#endif
+  unsigned long _anon_window_start;
+  int _anon_ecdh_count;   // since _anon_window_start
+  uint32_t n_anon_ecdh;
+  uint32_t n_anon_limited;
 
   void removeSelfFromPath(Packet* packet);
+  void checkFloodSuppression(const Packet* pkt);
   void routeDirectRecvAcks(Packet* packet, uint32_t delay_millis);
   //void routeRecvAcks(Packet* packet, uint32_t delay_millis);
   DispatcherAction forwardMultipartDirect(Packet* pkt);
+  void recvPeerMultipart(Packet* pkt);
+  bool appendToQueuedAck(uint32_t ack_crc, const uint8_t* path, uint8_t path_len, uint8_t ver);
+  bool expandCompactAdvert(Packet* pkt);
+  bool convertFloodToDirect(Packet* packet);
+  int getAdvertSignedData(const Packet* pkt, uint8_t* message) const;
+  DispatcherAction acceptAdvert(Packet* pkt);
+  bool verifyAdvert(const Identity& id, const uint8_t* sig, const uint8_t* message, int msg_len);
+  void verifyPendingAdverts();
+  bool getAnonSecret(uint8_t* secret, const uint8_t* sender_pub_key);
 
 protected:
   DispatcherAction onRecvPacket(Packet* pkt) override;
@@ -54,21 +159,31 @@ protected:
    */
   virtual uint32_t getRetransmitDelay(const Packet* packet);
 
+  /**
+   * \brief  Counter-based flood suppression. While our re-transmit of a flood packet is still queued, other neighbours
+   *     heard re-transmitting the same packet are counted, and once the count reaches this threshold ours is cancelled.
+   * \returns  the duplicate count threshold, or zero to always re-transmit (default)
+   */
+  virtual uint8_t getFloodSuppressThreshold(const Packet* packet) const { return 0; }
+
   /**
    * \returns  number of milliseconds delay to apply to retransmitting the given packet, for DIRECT mode.
    */
   virtual uint32_t getDirectRetransmitDelay(const Packet* packet);
 
   /**
+   * \param  path  the path the ACK will be sent DIRECT along (from this node)
+   * \param  hash_size  size of each hop in 'path'
    * \returns  number of extra (Direct) ACK transmissions wanted.
    */
-  virtual uint8_t getExtraAckTransmitCount() const;
+  virtual uint8_t getExtraAckTransmitCount(const uint8_t* path, uint8_t path_len, uint8_t hash_size);
 
   /**
    * \brief  Perform search of local DB of peers/contacts.
+   * \param  hash_size  number of bytes in 'hash' (PATH_HASH_SIZE for V1 packets, PATH_HASH_SIZE_V2 for V2)
    * \returns  Number of peers with matching hash
    */
-  virtual int searchPeersByHash(const uint8_t* hash);
+  virtual int searchPeersByHash(const uint8_t* hash, uint8_t hash_size);
 
   /**
    * \brief  lookup the ECDH shared-secret between this node and peer by idx (calculate if necessary)
@@ -77,13 +192,22 @@ protected:
    */
   virtual void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) { }
 
+  /**
+   * \brief  lookup the pre-computed HMAC state of the shared-secret between this node and peer by idx
+   * \param  peer_idx  index of peer, [0..n) where n is what searchPeersByHash() returned
+   * \returns  NULL if not available (MAC will be calculated from the shared-secret instead, or taken from the
+   *           CryptoContext cache). Contacts (possibly hundreds) rely on that cache, rather than pay 64 bytes each.
+   */
+  virtual const HMACState* getPeerHMACState(int peer_idx) { return NULL; }
+
   /**
    * \brief  A (now decrypted) data packet has been received (by a known peer).
    *         NOTE: these can be received multiple times (per sender/msg-id), via different routes
-   * \param  type  one of: PAYLOAD_TYPE_TXT_MSG, PAYLOAD_TYPE_REQ, PAYLOAD_TYPE_RESPONSE
+   * \param  type  one of: PAYLOAD_TYPE_TXT_MSG, PAYLOAD_TYPE_REQ, PAYLOAD_TYPE_RESPONSE, or PAYLOAD_TYPE_MULTIPART
+   *               (a part of a larger REQ/RESPONSE, see createMultipartDatagram())
    * \param  sender_idx  index of peer, [0..n) where n is what searchPeersByHash() returned
    * \param  secret   the pre-calculated shared-secret (handy for sending response packet)
-   * \param  data   decrypted data from payload
+   * \param  data   decrypted data from payload. For PAYLOAD_TYPE_MULTIPART, data[0] is the (unencrypted) multipart header byte
   */
   virtual void onPeerDataRecv(Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) { }
 
@@ -108,12 +232,44 @@ protected:
   */
   virtual bool onPeerPathRecv(Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) { return false; }
 
+  /**
+   * \brief  Peer (sender_idx) has told us the highest payload version it supports (in a returned path).
+   *         Called just before onPeerPathRecv().
+   * \param  max_ver  one of PAYLOAD_VER_*
+  */
+  virtual void onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) { }
+
   /**
    * \brief  A new incoming Advertisement has been received.
    *         NOTE: these can be received multiple times (per id/timestamp), via different routes
   */
   virtual void onAdvertRecv(Packet* packet, const Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len) { }
 
+  /**
+   * \brief  The first copy of a flood packet from 'src_hash' has been received, with the path it took to get here.
+   * \param  src_hash  sender's hash (Packet::getPathHashSize() bytes)
+  */
+  virtual void onFloodPathRecv(const uint8_t* src_hash, const Packet* packet) { }
+
+  /**
+   * \brief  A flood RESPONSE for 'dest_hash' is about to be re-transmitted. Sub-class can supply a known route to
+   *         the destination, and the packet is then sent DIRECT instead of being flooded further.
+   *         (other types stay floods, as the destination only sends a PATH return for those received by flood)
+   * \param  path  OUT - route to the destination (MAX_PATH_SIZE), in Packet::getPathHashSize() hops
+   * \returns  length of route in 'path' (zero means a direct neighbour), or -1 to keep flooding
+  */
+  virtual int getDirectRouteFor(const uint8_t* dest_hash, const Packet* packet, uint8_t* path) { return -1; }
+
+  /**
+   * \brief  A compact (V2) advert has been received, which refers to a known sender by pub_key prefix, and only carries
+   *         a delta of its app_data (see createCompactAdvert()). The full advert is then verified and passed to onAdvertRecv().
+   * \param  key_prefix  first ADVERT_KEY_PREFIX_SIZE bytes of sender's pub_key
+   * \param  id   OUT - the sender's full Identity
+   * \param  app_data  OUT - the full app_data (MAX_ADVERT_DATA_SIZE), reconstructed from 'delta'
+   * \returns  length of app_data, or -1 if sender is unknown, or delta doesn't apply to what we know of it
+  */
+  virtual int resolveCompactAdvert(const uint8_t* key_prefix, const uint8_t* delta, int delta_len, Identity& id, uint8_t app_data[]) { return -1; }
+
   /**
    * \brief  A (now decrypted) data packet has been received.
    *         NOTE: these can be received multiple times (per sender/contents), via different routes
@@ -157,6 +313,20 @@ protected:
   Mesh(Radio& radio, MillisecondClock& ms, RNG& rng, RTCClock& rtc, PacketManager& mgr, MeshTables& tables)
     : Dispatcher(radio, ms, mgr), _rng(&rng), _rtc(&rtc), _tables(&tables)
   {
+    memset(_pending_floods, 0, sizeof(_pending_floods));
+    _next_pending_flood = 0;
+    n_flood_suppressed = 0;
+    n_flood_direct_routed = 0;
+    _anon_window_start = 0;
+    _anon_ecdh_count = 0;
+    n_anon_ecdh = n_anon_limited = 0;
+  #if MESH_STACK_STATS
+    _stack_base = 0;
+    _max_stack_used = 0;
+  #endif
+  #if ADVERT_BATCH_SIZE
+    _num_pending_adverts = 0;
+  #endif
   }
 
   MeshTables* getTables() const { return _tables; }
@@ -168,16 +338,41 @@ public:
   LocalIdentity self_id;
 
   RNG* getRNG() const { return _rng; }
+  uint32_t getNumFloodSuppressed() const { return n_flood_suppressed; }
+  void resetFloodSuppressedStats() { n_flood_suppressed = 0; n_flood_direct_routed = 0; }
+  uint32_t getNumFloodDirectRouted() const { return n_flood_direct_routed; }
+  uint32_t getNumAnonECDH() const { return n_anon_ecdh; }
+  uint32_t getNumAnonRateLimited() const { return n_anon_limited; }
+  void resetAnonStats() { n_anon_ecdh = n_anon_limited = 0; }
+
+  /**
+   * \brief  records the current stack depth below loop(), if built with MESH_STACK_STATS. Mesh calls this from the deepest
+   *         points of the receive path, apps can also call it from their own callbacks.
+  */
+  void sampleStack();
+  uint32_t getMaxStackUsed() const;   // in bytes, zero if not MESH_STACK_STATS
   RTCClock* getRTCClock() const { return _rtc; }
 
   Packet* createAdvert(const LocalIdentity& id, const uint8_t* app_data=NULL, size_t app_data_len=0);
-  Packet* createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t len);
-  Packet* createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len);
+  /**
+   * \brief  creates a compact (V2) advert, for sending zero hop only. It is signed exactly like the full advert of 'app_data',
+   *         but only carries a pub_key prefix, and 'delta' in place of app_data.
+   * \param  delta  app-specific encoding of 'app_data', relative to something receivers already know (eg. AdvertDeltaHelper)
+  */
+  Packet* createCompactAdvert(const LocalIdentity& id, const uint8_t* app_data, size_t app_data_len, const uint8_t* delta, size_t delta_len);
+  Packet* createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t len, uint8_t ver=PAYLOAD_VER_1);
+  Packet* createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len, uint8_t ver=PAYLOAD_VER_1);
   Packet* createGroupDatagram(uint8_t type, const GroupChannel& channel, const uint8_t* data, size_t data_len);
-  Packet* createAck(uint32_t ack_crc);
-  Packet* createMultiAck(uint32_t ack_crc, uint8_t remaining);
-  Packet* createPathReturn(const uint8_t* dest_hash, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len);
-  Packet* createPathReturn(const Identity& dest, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len);
+  /**
+   * \brief  creates an encrypted part of a larger REQ or RESPONSE, to be sent DIRECT to a known peer.
+   * \param  mp_header  first (unencrypted) byte of payload. Lower 4 bits must be PAYLOAD_TYPE_REQ or PAYLOAD_TYPE_RESPONSE,
+   *                    upper 4 bits are for the application (eg. helpers/FragmentTransfer)
+  */
+  Packet* createMultipartDatagram(uint8_t mp_header, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t len, uint8_t ver=PAYLOAD_VER_1);
+  Packet* createAck(uint32_t ack_crc, uint8_t ver=PAYLOAD_VER_1);
+  Packet* createMultiAck(uint32_t ack_crc, uint8_t remaining, uint8_t ver=PAYLOAD_VER_1);
+  Packet* createPathReturn(const uint8_t* dest_hash, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len, uint8_t ver=PAYLOAD_VER_1);
+  Packet* createPathReturn(const Identity& dest, const uint8_t* secret, const uint8_t* path, uint8_t path_len, uint8_t extra_type, const uint8_t*extra, size_t extra_len, uint8_t ver=PAYLOAD_VER_1);
   Packet* createRawData(const uint8_t* data, size_t len);
   Packet* createTrace(uint32_t tag, uint32_t auth_code, uint8_t flags = 0);
 
@@ -191,6 +386,14 @@ public:
   */
   void sendDirect(Packet* packet, const uint8_t* path, uint8_t path_len, uint32_t delay_millis=0);
 
+  /**
+   * \brief  send an ACK with Direct routing. If another ACK is still queued for the same path, this CRC is just
+   *         appended to it (making it a PAYLOAD_TYPE_ACK_BUNDLE), saving the airtime of a separate packet.
+   * \param  can_bundle  true if recipient understands PAYLOAD_TYPE_ACK_BUNDLE (ie. has advertised > PAYLOAD_VER_1).
+   *                     If so, the ACK is held for at least ACK_BUNDLE_HOLD_MILLIS, otherwise a plain ACK is sent.
+  */
+  void sendDirectAck(uint32_t ack_crc, const uint8_t* path, uint8_t path_len, uint32_t delay_millis, uint8_t ver, bool can_bundle);
+
   /**
    * \brief  send a locally-generated Packet to just neigbor nodes (zero hops)
   */
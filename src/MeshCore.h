@@ -8,6 +8,7 @@
 #define SEED_SIZE           32
 #define SIGNATURE_SIZE      64
 #define MAX_ADVERT_DATA_SIZE  32
+#define ADVERT_KEY_PREFIX_SIZE  8   // compact (V2) adverts identify sender by this much of pub_key
 #define CIPHER_KEY_SIZE     16
 #define CIPHER_BLOCK_SIZE   16
 
@@ -15,6 +16,13 @@
 #define CIPHER_MAC_SIZE      2
 #define PATH_HASH_SIZE       1
 
+// V2
+#define CIPHER_MAC_SIZE_V2   4
+#define PATH_HASH_SIZE_V2    2
+
+#define MAX_CIPHER_MAC_SIZE  4
+#define MAX_PATH_HASH_SIZE   2
+
 #define MAX_PACKET_PAYLOAD  184
 #define MAX_PATH_SIZE        64
 #define MAX_TRANS_UNIT      255
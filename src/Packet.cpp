@@ -1,6 +1,6 @@
 #include "Packet.h"
 #include <string.h>
-#include <SHA256.h>
+#include "CryptoBackend.h"
 
 namespace mesh {
 
@@ -8,6 +8,9 @@ Packet::Packet() {
   header = 0;
   path_len = 0;
   payload_len = 0;
+  _snr = 0;
+  _cancel_ack = 0;
+  _can_bundle = false;
 }
 
 int Packet::getRawLength() const {
@@ -15,7 +18,7 @@ int Packet::getRawLength() const {
 }
 
 void Packet::calculatePacketHash(uint8_t* hash) const {
-  SHA256 sha;
+  SHA256Hash sha;
   uint8_t t = getPayloadType();
   sha.update(&t, 1);
   if (t == PAYLOAD_TYPE_TRACE) {
@@ -25,6 +28,36 @@ void Packet::calculatePacketHash(uint8_t* hash) const {
   sha.finalize(hash, MAX_HASH_SIZE);
 }
 
+#if MESH_CRYPTO_ACCEL
+  #define PACKET_HASH_BATCH   8
+#else
+  #define PACKET_HASH_BATCH   1    // no gain from batching, so save the stack
+#endif
+
+void Packet::calculatePacketHashes(int count, const Packet* const packets[], uint8_t* const dest_hashes[]) {
+  uint8_t bufs[PACKET_HASH_BATCH][1 + sizeof(path_len) + MAX_PACKET_PAYLOAD];
+  const uint8_t* msgs[PACKET_HASH_BATCH];
+  size_t lens[PACKET_HASH_BATCH];
+
+  for (int i = 0; i < count; i += PACKET_HASH_BATCH) {
+    int n = (count - i < PACKET_HASH_BATCH) ? count - i : PACKET_HASH_BATCH;
+    for (int j = 0; j < n; j++) {   // same input as calculatePacketHash()
+      const Packet* pkt = packets[i + j];
+      int len = 0;
+      uint8_t t = pkt->getPayloadType();
+      bufs[j][len++] = t;
+      if (t == PAYLOAD_TYPE_TRACE) {
+        memcpy(&bufs[j][len], &pkt->path_len, sizeof(pkt->path_len));
+        len += sizeof(pkt->path_len);
+      }
+      memcpy(&bufs[j][len], pkt->payload, pkt->payload_len);
+      msgs[j] = bufs[j];
+      lens[j] = len + pkt->payload_len;
+    }
+    CryptoBackend::sha256Multi(n, msgs, lens, &dest_hashes[i], MAX_HASH_SIZE);
+  }
+}
+
 uint8_t Packet::writeTo(uint8_t dest[]) const {
   uint8_t i = 0;
   dest[i++] = header;
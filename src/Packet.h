@@ -27,11 +27,12 @@ namespace mesh {
 #define PAYLOAD_TYPE_PATH        0x08    // returned path (prefixed with dest/src hashes, MAC) (enc data: path, extra)
 #define PAYLOAD_TYPE_TRACE       0x09    // trace a path, collecting SNI for each hop
 #define PAYLOAD_TYPE_MULTIPART   0x0A    // packet is one of a set of packets
+#define PAYLOAD_TYPE_ACK_BUNDLE  0x0B    // several acks along the same DIRECT path (4-byte CRCs, concatenated)
 //...
 #define PAYLOAD_TYPE_RAW_CUSTOM   0x0F    // custom packet as raw bytes, for applications with custom encryption, payloads, etc
 
 #define PAYLOAD_VER_1       0x00   // 1-byte src/dest hashes, 2-byte MAC
-#define PAYLOAD_VER_2       0x01   // FUTURE (eg. 2-byte hashes, 4-byte MAC ??)
+#define PAYLOAD_VER_2       0x01   // 2-byte path/src/dest hashes, 4-byte MAC
 #define PAYLOAD_VER_3       0x02   // FUTURE
 #define PAYLOAD_VER_4       0x03   // FUTURE
 
@@ -48,6 +49,8 @@ public:
   uint8_t path[MAX_PATH_SIZE];
   uint8_t payload[MAX_PACKET_PAYLOAD];
   int8_t _snr;
+  uint32_t _cancel_ack;   // (local only, not transmitted) an ACK CRC which makes this packet redundant if still queued, or zero
+  bool _can_bundle;       // (local only) a queued ACK which other ACK CRCs may be appended to (see Mesh::sendDirectAck())
 
   /**
    * \brief calculate the hash of payload + type
@@ -55,6 +58,12 @@ public:
    */
   void calculatePacketHash(uint8_t* dest_hash) const;
 
+  /**
+   * \brief  same as calculatePacketHash(), for several packets in one pass (see CryptoBackend::sha256Multi())
+   * \param  dest_hashes   each must be MAX_HASH_SIZE bytes
+   */
+  static void calculatePacketHashes(int count, const Packet* const packets[], uint8_t* const dest_hashes[]);
+
   /**
    * \returns  one of ROUTE_ values
    */
@@ -74,6 +83,19 @@ public:
    * \returns  one of PAYLOAD_VER_ values
    */
   uint8_t getPayloadVer() const { return (header >> PH_VER_SHIFT) & PH_VER_MASK; }
+  void setPayloadVer(uint8_t ver) { header = (header & ~(PH_VER_MASK << PH_VER_SHIFT)) | ((ver & PH_VER_MASK) << PH_VER_SHIFT); }
+
+  /**
+   * \returns  size (in bytes) of each hash in path, and of the src/dest hashes, for the given PAYLOAD_VER_ value
+   */
+  static uint8_t hashSizeFor(uint8_t ver) { return ver == PAYLOAD_VER_2 ? PATH_HASH_SIZE_V2 : PATH_HASH_SIZE; }
+  /**
+   * \returns  size (in bytes) of the MAC of encrypted payloads, for the given PAYLOAD_VER_ value
+   */
+  static uint8_t macSizeFor(uint8_t ver) { return ver == PAYLOAD_VER_2 ? CIPHER_MAC_SIZE_V2 : CIPHER_MAC_SIZE; }
+
+  uint8_t getPathHashSize() const { return hashSizeFor(getPayloadVer()); }
+  uint8_t getMACSize() const { return macSizeFor(getPayloadVer()); }
 
   void markDoNotRetransmit() { header = 0xFF; }
   bool isMarkedDoNotRetransmit() const { return header == 0xFF; }
@@ -1,6 +1,5 @@
 #include "Utils.h"
-#include <AES.h>
-#include <SHA256.h>
+#include "CryptoBackend.h"
 
 #ifdef ARDUINO
   #include <Arduino.h>
@@ -15,24 +14,24 @@ uint32_t RNG::nextInt(uint32_t _min, uint32_t _max) {
 }
 
 void Utils::sha256(uint8_t *hash, size_t hash_len, const uint8_t* msg, int msg_len) {
-  SHA256 sha;
+  SHA256Hash sha;
   sha.update(msg, msg_len);
   sha.finalize(hash, hash_len);
 }
 
 void Utils::sha256(uint8_t *hash, size_t hash_len, const uint8_t* frag1, int frag1_len, const uint8_t* frag2, int frag2_len) {
-  SHA256 sha;
+  SHA256Hash sha;
   sha.update(frag1, frag1_len);
   sha.update(frag2, frag2_len);
   sha.finalize(hash, hash_len);
 }
 
 int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  AES128 aes;
+  AESKey aes;
   uint8_t* dp = dest;
   const uint8_t* sp = src;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
+  aes.setKey(shared_secret);
   while (sp - src < src_len) {
     aes.decryptBlock(dp, sp);
     dp += 16; sp += 16;
@@ -42,10 +41,10 @@ int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 }
 
 int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  AES128 aes;
+  AESKey aes;
   uint8_t* dp = dest;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
+  aes.setKey(shared_secret);
   while (src_len >= 16) {
     aes.encryptBlock(dp, src);
     dp += 16; src += 16; src_len -= 16;
@@ -63,25 +62,56 @@ int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 int Utils::encryptThenMAC(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
   int enc_len = encrypt(shared_secret, dest + CIPHER_MAC_SIZE, src, src_len);
 
-  SHA256 sha;
-  sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-  sha.update(dest + CIPHER_MAC_SIZE, enc_len);
-  sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, dest, CIPHER_MAC_SIZE);
+  HMACState hmac;
+  initHMAC(hmac, shared_secret, PUB_KEY_SIZE);
+  calcHMAC(hmac, dest, CIPHER_MAC_SIZE, dest + CIPHER_MAC_SIZE, enc_len);
 
   return CIPHER_MAC_SIZE + enc_len;
 }
 
 int Utils::MACThenDecrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  if (src_len <= CIPHER_MAC_SIZE) return 0;  // invalid src bytes
-
-  uint8_t hmac[CIPHER_MAC_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-    sha.update(src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
-    sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, hmac, CIPHER_MAC_SIZE);
-  }
-  if (memcmp(hmac, src, CIPHER_MAC_SIZE) == 0) {
+  HMACState hmac;
+  initHMAC(hmac, shared_secret, PUB_KEY_SIZE);
+  return MACThenDecrypt(hmac, shared_secret, dest, src, src_len);
+}
+
+void Utils::initHMAC(HMACState& state, const uint8_t* key, int key_len) {
+  uint8_t block[64];
+
+  memset(block, 0x36, sizeof(block));
+  for (int i = 0; i < key_len; i++) block[i] ^= key[i];
+  memcpy(state.inner, CryptoBackend::SHA256_INIT, sizeof(state.inner));
+  CryptoBackend::sha256Blocks(state.inner, block, 1);
+
+  memset(block, 0x5C, sizeof(block));
+  for (int i = 0; i < key_len; i++) block[i] ^= key[i];
+  memcpy(state.outer, CryptoBackend::SHA256_INIT, sizeof(state.outer));
+  CryptoBackend::sha256Blocks(state.outer, block, 1);
+}
+
+void Utils::calcHMAC(const HMACState& state, uint8_t* mac, size_t mac_len, const uint8_t* msg, int msg_len) {
+  uint8_t digest[32];
+  SHA256Hash sha;
+  sha.resume(state.inner, 64);   // ie. key^ipad block already consumed
+  sha.update(msg, msg_len);
+  sha.finalize(digest, sizeof(digest));
+
+  sha.resume(state.outer, 64);
+  sha.update(digest, sizeof(digest));
+  sha.finalize(digest, sizeof(digest));
+  memcpy(mac, digest, mac_len);
+}
+
+bool Utils::verifyMAC(const HMACState& state, const uint8_t* src, int src_len, uint8_t mac_size) {
+  if (src_len <= mac_size || mac_size > MAX_CIPHER_MAC_SIZE) return false;  // invalid src bytes
+
+  uint8_t hmac[MAX_CIPHER_MAC_SIZE];
+  calcHMAC(state, hmac, mac_size, src + mac_size, src_len - mac_size);
+  return memcmp(hmac, src, mac_size) == 0;
+}
+
+int Utils::MACThenDecrypt(const HMACState& hmac, const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
+  if (verifyMAC(hmac, src, src_len)) {
     return decrypt(shared_secret, dest, src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
   }
   return 0; // invalid HMAC
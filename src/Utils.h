@@ -6,6 +6,15 @@
 
 namespace mesh {
 
+/**
+ * \brief  An HMAC-SHA256 key, pre-processed into the inner and outer SHA256 states.
+ *          (ie. the key^ipad and key^opad blocks are already compressed, so don't need re-hashing per MAC)
+*/
+struct HMACState {
+  uint32_t inner[8];
+  uint32_t outer[8];
+};
+
 class RNG {
 public:
   virtual void random(uint8_t* dest, size_t sz) = 0;
@@ -54,6 +63,29 @@ public:
   */
   static int MACThenDecrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len);
 
+  /**
+   * \brief  pre-computes the HMAC inner/outer states for the given key. (key_len must be <= 64)
+  */
+  static void initHMAC(HMACState& state, const uint8_t* key, int key_len);
+
+  /**
+   * \brief  calculates HMAC-SHA256 of 'msg', using pre-computed key 'state', storing in 'mac' and truncating to 'mac_len' bytes.
+  */
+  static void calcHMAC(const HMACState& state, uint8_t* mac, size_t mac_len, const uint8_t* msg, int msg_len);
+
+  /**
+   * \brief  checks the MAC (in leading bytes of 'src') against the remaining bytes, using pre-computed key 'state'.
+   * \param  mac_size  CIPHER_MAC_SIZE (V1) or CIPHER_MAC_SIZE_V2
+   * \returns  true if MAC is valid
+  */
+  static bool verifyMAC(const HMACState& state, const uint8_t* src, int src_len, uint8_t mac_size=CIPHER_MAC_SIZE);
+
+  /**
+   * \brief  same as MACThenDecrypt() above, but with 'hmac' being the pre-computed HMAC state of 'shared_secret'.
+   * \returns  zero if MAC is invalid, otherwise the length of decrypted bytes in 'dest'
+  */
+  static int MACThenDecrypt(const HMACState& hmac, const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len);
+
   /**
    * \brief  converts 'src' bytes with given length to Hex representation, and null terminates.
   */
@@ -0,0 +1,67 @@
+#include "AckLossTable.h"
+#include <string.h>
+
+#define STATS_AGE_THRESHOLD   16   // halve sent/lost when sent reaches this, so recent outcomes dominate
+
+void AckLossTable::clear() {
+  memset(_entries, 0, sizeof(_entries));
+  _use_counter = 0;
+}
+
+uint32_t AckLossTable::calcKey(const uint8_t* path, uint8_t path_len) {
+  uint32_t h = 2166136261UL;   // FNV-1a
+  h = (h ^ path_len) * 16777619UL;
+  for (int i = 0; i < path_len; i++) {
+    h = (h ^ path[i]) * 16777619UL;
+  }
+  return h ? h : 1;   // zero means unused
+}
+
+void AckLossTable::onAckSent(const uint8_t* path, uint8_t path_len, uint32_t msg_id) {
+  uint32_t key = calcKey(path, path_len);
+
+  Entry* e = NULL;
+  Entry* victim = &_entries[0];
+  for (int i = 0; i < ACK_LOSS_TABLE_SIZE; i++) {
+    auto p = &_entries[i];
+    if (p->key == key) { e = p; break; }
+    if (p->last_used < victim->last_used) victim = p;   // least recently used (or unused)
+  }
+  if (e == NULL) {
+    e = victim;
+    memset(e, 0, sizeof(*e));
+    e->key = key;
+  } else if (e->last_msg == msg_id) {
+    e->lost++;   // a retry of the message we last ACK'd
+  }
+  e->sent++;
+  e->last_msg = msg_id;
+  e->last_used = ++_use_counter;
+
+  if (e->sent >= STATS_AGE_THRESHOLD) {
+    e->sent >>= 1;
+    e->lost >>= 1;
+  }
+}
+
+int AckLossTable::getLossPercent(const uint8_t* path, uint8_t path_len) const {
+  uint32_t key = calcKey(path, path_len);
+  for (int i = 0; i < ACK_LOSS_TABLE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->key == key) {
+      return (e->lost * 100) / (e->sent + 1);   // +1 so a single sample isn't taken as 100% loss
+    }
+  }
+  return 0;  // not known
+}
+
+uint8_t AckLossTable::calcExtraAcks(uint8_t min_extra, int hops, int loss_pct) {
+  int extra = 0;
+  if (hops >= ADAPTIVE_ACK_LONG_PATH) extra++;
+  if (loss_pct >= 20) extra++;
+  if (loss_pct >= 50) extra++;
+
+  if (extra < min_extra) extra = min_extra;
+  if (extra > ADAPTIVE_ACK_MAX_EXTRA) extra = ADAPTIVE_ACK_MAX_EXTRA;   // also bounds min_extra (a pref)
+  return extra;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Mesh.h>
+
+#ifndef ACK_LOSS_TABLE_SIZE
+  #define ACK_LOSS_TABLE_SIZE        8
+#endif
+
+#ifndef ADAPTIVE_ACK_MAX_EXTRA
+  #define ADAPTIVE_ACK_MAX_EXTRA     2
+#endif
+#if ADAPTIVE_ACK_MAX_EXTRA > 15
+  #error ADAPTIVE_ACK_MAX_EXTRA must fit in the 4-bit 'remaining' of a multipart ACK
+#endif
+
+#ifndef ADAPTIVE_ACK_LONG_PATH
+  #define ADAPTIVE_ACK_LONG_PATH     4    // hops. Each hop is another chance to lose the ACK
+#endif
+
+/**
+ * \brief  Estimates how often the direct ACKs we send along each path are lost. When a message we have already
+ *         ACK'd arrives again (ie. a retry), the sender evidently didn't receive our ACK.
+*/
+class AckLossTable {
+  struct Entry {
+    uint32_t key;         // hash of path, zero if slot unused
+    uint32_t last_msg;    // id of last message ACK'd along this path
+    uint8_t sent, lost;
+    uint32_t last_used;
+  };
+  Entry _entries[ACK_LOSS_TABLE_SIZE];
+  uint32_t _use_counter;
+
+  static uint32_t calcKey(const uint8_t* path, uint8_t path_len);
+
+public:
+  AckLossTable() { clear(); }
+
+  void clear();
+
+  /**
+   * \brief  an ACK is about to be sent DIRECT along 'path'
+   * \param  msg_id  identifies the message being ACK'd, the same for all attempts (eg. sender's timestamp)
+  */
+  void onAckSent(const uint8_t* path, uint8_t path_len, uint32_t msg_id);
+
+  /**
+   * \returns  recent percentage of ACKs lost along 'path' (zero if not known)
+  */
+  int getLossPercent(const uint8_t* path, uint8_t path_len) const;
+
+  /**
+   * \brief  policy for how many extra ACKs to send, given the hop count and loss rate of the path.
+   * \param  min_extra  lower bound (eg. from the 'multi.acks' pref)
+   * \returns  number of extra ACKs, from min_extra up to ADAPTIVE_ACK_MAX_EXTRA (which also caps min_extra)
+  */
+  static uint8_t calcExtraAcks(uint8_t min_extra, int hops, int loss_pct);
+};
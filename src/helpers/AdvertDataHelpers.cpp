@@ -84,4 +84,97 @@ void AdvertTimeHelper::formatRelativeTimeDiff(char dest[], int32_t seconds_from_
       }
     }
   }
-}
\ No newline at end of file
+}
+#define NUM_ADV_FIELDS  4
+
+static const uint8_t adv_field_masks[NUM_ADV_FIELDS] = { ADV_LATLON_MASK, ADV_FEAT1_MASK, ADV_FEAT2_MASK, ADV_NAME_MASK };
+static const uint8_t adv_field_sizes[NUM_ADV_FIELDS] = { 8, 2, 2, 0 };   // name is remainder of app_data
+
+struct AdvertFields {
+  uint8_t flags;
+  int ofs[NUM_ADV_FIELDS];
+  int len[NUM_ADV_FIELDS];
+};
+
+static bool splitAdvertFields(const uint8_t app_data[], int app_data_len, AdvertFields& f) {
+  if (app_data_len < 1) return false;
+
+  f.flags = app_data[0];
+  int i = 1;
+  for (int k = 0; k < NUM_ADV_FIELDS; k++) {
+    f.ofs[k] = i;
+    f.len[k] = 0;
+    if (f.flags & adv_field_masks[k]) {
+      f.len[k] = adv_field_sizes[k] ? adv_field_sizes[k] : app_data_len - i;
+      i += f.len[k];
+    }
+  }
+  return i <= app_data_len;
+}
+
+int AdvertDeltaHelper::encodeDelta(uint8_t dest[], const uint8_t base[], int base_len, const uint8_t app_data[], int app_data_len) {
+  AdvertFields b, n;
+  bool has_base = splitAdvertFields(base, base_len, b);
+  if (!splitAdvertFields(app_data, app_data_len, n)) return 0;   // invalid app_data
+
+  mesh::Utils::sha256(dest, 2, base, base_len);
+  uint8_t mask = 0;
+  int i = ADV_DELTA_HDR_SIZE;
+  if (!has_base || n.flags != b.flags) {
+    mask |= ADV_DELTA_FLAGS;
+    dest[i++] = n.flags;
+  }
+  for (int k = 0; k < NUM_ADV_FIELDS; k++) {
+    if ((n.flags & adv_field_masks[k]) == 0) continue;   // field not present
+
+    if (has_base && (b.flags & adv_field_masks[k]) && b.len[k] == n.len[k]
+        && memcmp(&base[b.ofs[k]], &app_data[n.ofs[k]], n.len[k]) == 0) continue;   // unchanged
+
+    mask |= adv_field_masks[k];
+    memcpy(&dest[i], &app_data[n.ofs[k]], n.len[k]); i += n.len[k];
+  }
+  dest[2] = mask;
+  return i;
+}
+
+int AdvertDeltaHelper::applyDelta(uint8_t app_data[], const uint8_t base[], int base_len, const uint8_t delta[], int delta_len) {
+  if (delta_len < ADV_DELTA_HDR_SIZE) return -1;
+
+  uint8_t hash[2];
+  mesh::Utils::sha256(hash, sizeof(hash), base, base_len);
+  AdvertFields b;
+  if (memcmp(hash, delta, 2) != 0 || !splitAdvertFields(base, base_len, b)) return -1;   // not the same base
+
+  uint8_t mask = delta[2];
+  int i = ADV_DELTA_HDR_SIZE;
+  uint8_t flags = b.flags;
+  if (mask & ADV_DELTA_FLAGS) {
+    if (i >= delta_len) return -1;
+    flags = delta[i++];
+  }
+
+  app_data[0] = flags;
+  int j = 1;
+  for (int k = 0; k < NUM_ADV_FIELDS; k++) {
+    if ((flags & adv_field_masks[k]) == 0) {
+      if (mask & adv_field_masks[k]) return -1;   // malformed
+      continue;
+    }
+
+    const uint8_t* sp;
+    int len;
+    if (mask & adv_field_masks[k]) {
+      sp = &delta[i];
+      len = adv_field_sizes[k] ? adv_field_sizes[k] : delta_len - i;
+      i += len;
+      if (i > delta_len) return -1;
+    } else {
+      if ((b.flags & adv_field_masks[k]) == 0) return -1;   // field not in base
+      sp = &base[b.ofs[k]];
+      len = b.len[k];
+    }
+    if (j + len > MAX_ADVERT_DATA_SIZE) return -1;
+    memcpy(&app_data[j], sp, len); j += len;
+  }
+  return j;
+}
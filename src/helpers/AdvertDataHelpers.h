@@ -65,6 +65,32 @@ public:
   double getLon() const { return ((double)_lon) / 1000000.0; }
 };
 
+/*
+ * Delta encoding of app_data, for compact adverts (see Mesh::createCompactAdvert()):
+ *   base_hash(2) | field_mask(1) | [flags(1)] | [lat/lon(8)] | [feat1(2)] | [feat2(2)] | [name]
+ * Only the fields whose bit is set in field_mask are present (ADV_*_MASK bits, plus ADV_DELTA_FLAGS for the flags byte),
+ * all other fields are copied from the base app_data, which is identified by the first 2 bytes of its SHA256.
+*/
+#define ADV_DELTA_FLAGS       0x01
+#define ADV_DELTA_HDR_SIZE    3
+
+class AdvertDeltaHelper {
+public:
+  /**
+   * \brief  encode 'app_data' as only the fields which differ from 'base'
+   * \param  dest  must be at least ADV_DELTA_HDR_SIZE + MAX_ADVERT_DATA_SIZE
+   * \returns  length of the delta in 'dest'
+   */
+  static int encodeDelta(uint8_t dest[], const uint8_t base[], int base_len, const uint8_t app_data[], int app_data_len);
+
+  /**
+   * \brief  re-construct the full app_data from a delta, and the base it was encoded against
+   * \param  app_data  dest array, must be MAX_ADVERT_DATA_SIZE
+   * \returns  length of app_data, or -1 if 'base' is not the one the delta was encoded against
+   */
+  static int applyDelta(uint8_t app_data[], const uint8_t base[], int base_len, const uint8_t delta[], int delta_len);
+};
+
 class AdvertTimeHelper {
 public:
   static void formatRelativeTimeDiff(char dest[], int32_t seconds_from_now, bool short_fmt);
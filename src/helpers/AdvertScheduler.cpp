@@ -0,0 +1,52 @@
+#include "AdvertScheduler.h"
+
+void AdvertScheduler::schedule() {
+  uint32_t t = _interval;
+  if (_interval > _floor) {
+    t -= _rng->nextInt(0, _interval / 4);   // de-synchronise from neighbours who are also backing off
+  }
+  _next = _ms->getMillis() + t;
+  if (_next == 0) _next = 1;   // zero means stopped
+}
+
+void AdvertScheduler::begin(uint32_t floor_millis) {
+  _floor = _interval = floor_millis;
+  _hold = false;
+  if (_floor > 0) {
+    schedule();
+  } else {
+    _next = 0;  // stop the timer
+  }
+}
+
+void AdvertScheduler::backoff(uint32_t ceiling_millis) {
+  if (_floor == 0) return;   // stopped
+
+  if (ceiling_millis < _floor) ceiling_millis = _floor;
+  if (_hold) {
+    _hold = false;    // first interval after a reset() stays at the floor
+  } else if (_interval <= ceiling_millis / 2) {
+    _interval *= 2;
+  } else {
+    _interval = ceiling_millis;
+  }
+  schedule();
+}
+
+void AdvertScheduler::restart() {
+  if (_floor > 0) schedule();
+}
+
+void AdvertScheduler::reset() {
+  if (_floor == 0) return;   // stopped
+
+  _hold = true;
+  if (_interval == _floor) return;   // already at floor
+
+  _interval = _floor;
+  unsigned long soonest = _ms->getMillis() + _floor / 2 + _rng->nextInt(0, _floor / 2);
+  if ((long)(_next - soonest) > 0) {
+    _next = soonest;
+    if (_next == 0) _next = 1;
+  }
+}
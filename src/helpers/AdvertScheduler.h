@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Mesh.h>
+
+/**
+ * \brief  Trickle-style advert timer. The interval starts at a 'floor', and doubles after each advert is sent
+ *         (up to a 'ceiling') while the neighbourhood is stable. Any detected change resets it back to the floor.
+ *         With ceiling == floor it behaves exactly like a fixed interval timer.
+*/
+class AdvertScheduler {
+  mesh::MillisecondClock* _ms;
+  mesh::RNG* _rng;
+  uint32_t _floor;      // millis, zero if stopped
+  uint32_t _interval;   // current interval, millis
+  unsigned long _next;  // zero if stopped
+  bool _hold;           // reset() since last advert, so don't back off after the next one
+
+  void schedule();
+
+public:
+  AdvertScheduler(mesh::MillisecondClock& ms, mesh::RNG& rng) : _ms(&ms), _rng(&rng) {
+    _floor = _interval = 0;
+    _next = 0;
+    _hold = false;
+  }
+
+  /**
+   * \brief  (re)starts the timer, with interval at the floor
+   * \param  floor_millis  the minimum interval, or zero to stop the timer
+  */
+  void begin(uint32_t floor_millis);
+
+  bool isRunning() const { return _next != 0; }
+  bool isDue() const { return _next && (long)(_ms->getMillis() - _next) > 0; }
+
+  /**
+   * \brief  an advert was just sent. Doubles the interval (neighbourhood is stable), and schedules the next advert.
+   * \param  ceiling_millis  the maximum interval. Values below the floor are treated as the floor.
+  */
+  void backoff(uint32_t ceiling_millis);
+
+  /**
+   * \brief  schedules next advert at the current interval from now, without backing off (eg. some other advert was sent)
+  */
+  void restart();
+
+  /**
+   * \brief  a change in the neighbourhood was detected. Drops interval back to the floor (including for the advert
+   *         after the next one), and brings the next advert forward if it was scheduled later than that.
+  */
+  void reset();
+
+  uint32_t getInterval() const { return _interval; }
+};
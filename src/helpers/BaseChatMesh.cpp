@@ -31,23 +31,55 @@ mesh::Packet* BaseChatMesh::createSelfAdvert(const char* name, double lat, doubl
   return createAdvert(self_id, app_data, app_data_len);
 }
 
-void BaseChatMesh::sendAckTo(const ContactInfo& dest, uint32_t ack_hash) {
+uint8_t BaseChatMesh::getSendPayloadVer(const ContactInfo& contact) const {
+  if (contact.out_path_len >= 0) return contact.payload_ver;   // must match format of out_path
+  return contact.max_payload_ver < MAX_PAYLOAD_VER ? contact.max_payload_ver : MAX_PAYLOAD_VER;
+}
+
+void BaseChatMesh::sendAckTo(const ContactInfo& dest, uint32_t ack_hash, uint32_t msg_timestamp) {
   if (dest.out_path_len < 0) {
-    mesh::Packet* ack = createAck(ack_hash);
+    mesh::Packet* ack = createAck(ack_hash);   // NOTE: flood ACKs are always V1, for widest reach
     if (ack) sendFlood(ack, TXT_ACK_DELAY);
   } else {
+    ack_losses.onAckSent(dest.out_path, dest.out_path_len, msg_timestamp);
+
     uint32_t d = TXT_ACK_DELAY;
-    if (getExtraAckTransmitCount() > 0) {
-      mesh::Packet* a1 = createMultiAck(ack_hash, 1);
+    uint8_t extra = getExtraAckTransmitCount(dest.out_path, dest.out_path_len, mesh::Packet::hashSizeFor(dest.payload_ver));
+    while (extra > 0) {
+      mesh::Packet* a1 = createMultiAck(ack_hash, extra, dest.payload_ver);
       if (a1) sendDirect(a1, dest.out_path, dest.out_path_len, d);
       d += 300;
+      extra--;
     }
 
-    mesh::Packet* a2 = createAck(ack_hash);
-    if (a2) sendDirect(a2, dest.out_path, dest.out_path_len, d);
+    sendDirectAck(ack_hash, dest.out_path, dest.out_path_len, d, dest.payload_ver, dest.canRecvAckBundle());
   }
 }
 
+int BaseChatMesh::resolveCompactAdvert(const uint8_t* key_prefix, const uint8_t* delta, int delta_len, mesh::Identity& id, uint8_t app_data[]) {
+  ContactInfo* from = NULL;
+  for (int i = 0; i < num_contacts; i++) {
+    if (memcmp(contacts[i].id.pub_key, key_prefix, ADVERT_KEY_PREFIX_SIZE) == 0) {
+      if (from) return -1;   // ambiguous prefix
+      from = &contacts[i];
+    }
+  }
+  if (from == NULL) return -1;   // not one of our contacts
+
+  // the base is their last full advert, as saved below (for the "Share..." function)
+  int len = getBlobByKey(from->id.pub_key, PUB_KEY_SIZE, temp_buf);
+  mesh::Packet base;
+  if (len <= 0 || !base.readFrom(temp_buf, len) || base.getPayloadType() != PAYLOAD_TYPE_ADVERT) return -1;
+
+  int i = PUB_KEY_SIZE + 4 + SIGNATURE_SIZE;
+  int base_len = base.payload_len - i;
+  if (base_len < 0) return -1;
+  if (base_len > MAX_ADVERT_DATA_SIZE) base_len = MAX_ADVERT_DATA_SIZE;
+
+  id = from->id;
+  return AdvertDeltaHelper::applyDelta(app_data, &base.payload[i], base_len, delta, delta_len);
+}
+
 void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len) {
   AdvertDataParser parser(app_data, app_data_len);
   if (!(parser.isValid() && parser.hasName())) {
@@ -95,12 +127,11 @@ void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id,
       from = &contacts[num_contacts++];
       from->id = id;
       from->out_path_len = -1;  // initially out_path is unknown
+      from->payload_ver = from->max_payload_ver = PAYLOAD_VER_1;   // until contact tells us otherwise
       from->gps_lat = 0;   // initially unknown GPS loc
       from->gps_lon = 0;
       from->sync_since = 0;
-
-      // only need to calculate the shared_secret once, for better performance
-      self_id.calcSharedSecret(from->shared_secret, id);
+      from->has_shared_secret = false;   // calculated on first use
     } else {
       MESH_DEBUG_PRINTLN("onAdvertRecv: contacts table is full!");
       return;
@@ -117,13 +148,17 @@ void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id,
   from->last_advert_timestamp = timestamp;
   from->lastmod = getRTCClock()->getCurrentTime();
 
+  if (packet->isRouteFlood() && from->payload_ver == PAYLOAD_VER_1) {   // NOTE: adverts are always V1
+    path_table.addReversedPath(from->id, packet->path, packet->path_len, PATH_HASH_SIZE);   // a candidate route back to them
+  }
+
   onDiscoveredContact(*from, is_new, packet->path_len, packet->path);       // let UI know
 }
 
-int BaseChatMesh::searchPeersByHash(const uint8_t* hash) {
+int BaseChatMesh::searchPeersByHash(const uint8_t* hash, uint8_t hash_size) {
   int n = 0;
   for (int i = 0; i < num_contacts && n < MAX_SEARCH_RESULTS; i++) {
-    if (contacts[i].id.isHashMatch(hash)) {
+    if (contacts[i].id.isHashMatch(hash, hash_size)) {
       matching_peer_indexes[n++] = i;  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
     }
   }
@@ -133,13 +168,19 @@ int BaseChatMesh::searchPeersByHash(const uint8_t* hash) {
 void BaseChatMesh::getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < num_contacts) {
-    // lookup pre-calculated shared_secret
-    memcpy(dest_secret, contacts[i].shared_secret, PUB_KEY_SIZE);
+    memcpy(dest_secret, contacts[i].getSharedSecret(self_id), PUB_KEY_SIZE);
   } else {
     MESH_DEBUG_PRINTLN("getPeerSharedSecret: Invalid peer idx: %d", i);
   }
 }
 
+void BaseChatMesh::onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) {
+  int i = matching_peer_indexes[sender_idx];
+  if (i >= 0 && i < num_contacts) {
+    contacts[i].max_payload_ver = max_ver;
+  }
+}
+
 void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) {
   int i = matching_peer_indexes[sender_idx];
   if (i < 0 || i >= num_contacts) {
@@ -149,6 +190,18 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
 
   ContactInfo& from = contacts[i];
 
+  if (packet->isRouteFlood() && packet->getPayloadVer() == from.payload_ver) {
+    path_table.addReversedPath(from.id, packet->path, packet->path_len, packet->getPathHashSize());   // a candidate route back to sender
+  }
+
+  if (type == PAYLOAD_TYPE_TXT_MSG && len > 5 && ((data[4] >> 2) & TXT_FLAG_COMPRESSED)) {
+    len = TextCompressor::expandTxtPayload(data, len, MAX_PACKET_PAYLOAD);
+    if (len == 0) {
+      MESH_DEBUG_PRINTLN("onPeerDataRecv: invalid compressed text");
+      return;
+    }
+  }
+
   if (type == PAYLOAD_TYPE_TXT_MSG && len > 5) {
     uint32_t timestamp;
     memcpy(&timestamp, data, 4);  // timestamp (by sender's RTC clock - which could be wrong)
@@ -167,10 +220,10 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the ACK
         mesh::Packet* path = createPathReturn(from.id, secret, packet->path, packet->path_len,
-                                                PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4);
+                                                PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4, packet->getPayloadVer());
         if (path) sendFlood(path, TXT_ACK_DELAY);
       } else {
-        sendAckTo(from, ack_hash);
+        sendAckTo(from, ack_hash, timestamp);
       }
     } else if (flags == TXT_TYPE_CLI_DATA) {
       onCommandDataRecv(from, packet, timestamp, (const char *) &data[5]);  // let UI know
@@ -178,7 +231,7 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
 
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect() (NOTE: no ACK as extra)
-        mesh::Packet* path = createPathReturn(from.id, secret, packet->path, packet->path_len, 0, NULL, 0);
+        mesh::Packet* path = createPathReturn(from.id, secret, packet->path, packet->path_len, 0, NULL, 0, packet->getPayloadVer());
         if (path) sendFlood(path);
       }
     } else if (flags == TXT_TYPE_SIGNED_PLAIN) {
@@ -194,10 +247,10 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the ACK
         mesh::Packet* path = createPathReturn(from.id, secret, packet->path, packet->path_len,
-                                                PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4);
+                                                PAYLOAD_TYPE_ACK, (uint8_t *) &ack_hash, 4, packet->getPayloadVer());
         if (path) sendFlood(path, TXT_ACK_DELAY);
       } else {
-        sendAckTo(from, ack_hash);
+        sendAckTo(from, ack_hash, timestamp);
       }
     } else {
       MESH_DEBUG_PRINTLN("onPeerDataRecv: unsupported message type: %u", (uint32_t) flags);
@@ -210,10 +263,10 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
       if (packet->isRouteFlood()) {
         // let this sender know path TO here, so they can use sendDirect(), and ALSO encode the response
         mesh::Packet* path = createPathReturn(from.id, secret, packet->path, packet->path_len,
-                                              PAYLOAD_TYPE_RESPONSE, temp_buf, reply_len);
+                                              PAYLOAD_TYPE_RESPONSE, temp_buf, reply_len, packet->getPayloadVer());
         if (path) sendFlood(path, SERVER_RESPONSE_DELAY);
       } else {
-        mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, from.id, secret, temp_buf, reply_len);
+        mesh::Packet* reply = createDatagram(PAYLOAD_TYPE_RESPONSE, from.id, secret, temp_buf, reply_len, getSendPayloadVer(from));
         if (reply) {
           if (from.out_path_len >= 0) {  // we have an out_path, so send DIRECT
             sendDirect(reply, from.out_path, from.out_path_len, SERVER_RESPONSE_DELAY);
@@ -225,12 +278,49 @@ void BaseChatMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender
     }
   } else if (type == PAYLOAD_TYPE_RESPONSE && len > 0) {
     onContactResponse(from, data, len);
-    if (packet->isRouteFlood() && from.out_path_len >= 0) {
+    if (packet->isRouteFlood() && from.out_path_len >= 0 && packet->getPayloadVer() == from.payload_ver) {
       // we have direct path, but other node is still sending flood response, so maybe they didn't receive reciprocal path properly(?)
       handleReturnPathRetry(from, packet->path, packet->path_len);
     }
+#ifdef WITH_FRAGMENT_TRANSFER
+  } else if (type == PAYLOAD_TYPE_MULTIPART) {
+    transfers.onPacketRecv(from.id.pub_key, data, len);   // fragment (or status) of a large REQ/RESPONSE
+#endif
+  }
+}
+
+void BaseChatMesh::onContactLargeResponse(const ContactInfo& contact, const uint8_t* data, int len) {
+  if (len <= 255) {
+    onContactResponse(contact, data, len);
+  } else {
+    MESH_DEBUG_PRINTLN("onContactLargeResponse: unhandled, len=%d", len);
+  }
+}
+
+#ifdef WITH_FRAGMENT_TRANSFER
+uint32_t BaseChatMesh::sendTransferPacket(const uint8_t* peer_key, uint8_t mp_header, const uint8_t* data, int len) {
+  auto contact = lookupContactByPubKey(peer_key, PUB_KEY_SIZE);
+  if (contact == NULL || contact->out_path_len < 0) return 0;   // fragments are only sent DIRECT
+
+  mesh::Packet* pkt = createMultipartDatagram(mp_header, contact->id, contact->getSharedSecret(self_id), data, len, getSendPayloadVer(*contact));
+  if (pkt == NULL) return 0;
+
+  uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
+  sendDirect(pkt, contact->out_path, contact->out_path_len);
+  return calcDirectTimeoutMillisFor(t, contact->out_path_len);
+}
+
+void BaseChatMesh::onTransferRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* blob, int len) {
+  auto contact = lookupContactByPubKey(peer_key, PUB_KEY_SIZE);
+  if (contact == NULL) return;   // removed since
+
+  if (type == PAYLOAD_TYPE_RESPONSE) {
+    onContactLargeResponse(*contact, blob, len);
+  } else {
+    MESH_DEBUG_PRINTLN("onTransferRecv: unsupported type: %d", (uint32_t) type);
   }
 }
+#endif
 
 bool BaseChatMesh::onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) {
   int i = matching_peer_indexes[sender_idx];
@@ -241,21 +331,37 @@ bool BaseChatMesh::onPeerPathRecv(mesh::Packet* packet, int sender_idx, const ui
 
   ContactInfo& from = contacts[i];
 
+  // the returned path is in the format of the PATH packet's version
+  if (packet->getPayloadVer() != from.payload_ver) {
+    path_table.clearPaths(from.id);   // existing candidates are in the old format
+    from.payload_ver = packet->getPayloadVer();
+    if (from.max_payload_ver < from.payload_ver) from.max_payload_ver = from.payload_ver;
+  }
   return onContactPathRecv(from, packet->path, packet->path_len, path, path_len, extra_type, extra, extra_len);
 }
 
 bool BaseChatMesh::onContactPathRecv(ContactInfo& from, uint8_t* in_path, uint8_t in_path_len, uint8_t* out_path, uint8_t out_path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) {
-  // NOTE: default impl, we just replace the current 'out_path' regardless, whenever sender sends us a new out_path.
-  // FUTURE: could store multiple out_paths per contact, and try to find which is the 'best'(?)
-  memcpy(from.out_path, out_path, from.out_path_len = out_path_len);  // store a copy of path, for sendDirect()
+  // NOTE: default impl, new out_path is added as a candidate, then the 'best' scoring candidate becomes the out_path
+  path_table.addPath(from.id, out_path, out_path_len, PATH_SRC_RETURNED, mesh::Packet::hashSizeFor(from.payload_ver));
+  int best_len = path_table.selectBestPath(from.id.pub_key, from.out_path, false);
+  if (best_len >= 0) {
+    from.out_path_len = best_len;
+  } else {
+    memcpy(from.out_path, out_path, from.out_path_len = out_path_len);  // store a copy of path, for sendDirect()
+  }
   from.lastmod = getRTCClock()->getCurrentTime();
 
   onContactPathUpdated(from);
 
   if (extra_type == PAYLOAD_TYPE_ACK && extra_len >= 4) {
     // also got an encoded ACK!
+    uint32_t ack_crc;
+    memcpy(&ack_crc, extra, 4);
+    path_table.onAckRecv(ack_crc);
+
     if (processAck(extra) != NULL) {
       txt_send_timeout = 0;   // matched one we're waiting for, cancel timeout timer
+      cancelOutboundByAck(ack_crc);   // any queued retry is now redundant
     }
   } else if (extra_type == PAYLOAD_TYPE_RESPONSE && extra_len > 0) {
     onContactResponse(from, extra, extra_len);
@@ -264,38 +370,113 @@ bool BaseChatMesh::onContactPathRecv(ContactInfo& from, uint8_t* in_path, uint8_
 }
 
 void BaseChatMesh::onAckRecv(mesh::Packet* packet, uint32_t ack_crc) {
+  path_table.onAckRecv(ack_crc);   // credit the path it was sent on (if DIRECT)
+
   ContactInfo* from;
   if ((from = processAck((uint8_t *)&ack_crc)) != NULL) {
     txt_send_timeout = 0;   // matched one we're waiting for, cancel timeout timer
     packet->markDoNotRetransmit();   // ACK was for this node, so don't retransmit
+    cancelOutboundByAck(ack_crc);   // any queued retry is now redundant
 
-    if (packet->isRouteFlood() && from->out_path_len >= 0) {
+    if (packet->isRouteFlood() && from->out_path_len >= 0 && packet->getPayloadVer() == from->payload_ver) {
       // we have direct path, but other node is still sending flood, so maybe they didn't receive reciprocal path properly(?)
       handleReturnPathRetry(*from, packet->path, packet->path_len);
     }
   }
 }
 
+void BaseChatMesh::onTraceRecv(mesh::Packet* packet, uint32_t tag, uint32_t auth_code, uint8_t flags, const uint8_t* path_snrs, const uint8_t* path_hashes, uint8_t path_len) {
+  path_table.onTraceSNRs(path_hashes, path_snrs, path_len);
+}
+
+void BaseChatMesh::handlePathFailover(uint32_t expected_ack) {
+  uint8_t key[PATH_KEY_PREFIX_SIZE];
+  if (expected_ack == 0 || !path_table.onAckTimeout(expected_ack, key)) return;
+
+  auto contact = lookupContactByPubKey(key, PATH_KEY_PREFIX_SIZE);
+  if (contact == NULL || contact->out_path_len < 0) return;   // removed, or path has since been reset
+
+  // switch to next best candidate, if the current out_path is no longer the best
+  uint8_t path[MAX_PATH_SIZE];
+  int len = path_table.selectBestPath(contact->id.pub_key, path, true);
+  if (len >= 0 && (len != contact->out_path_len || memcmp(path, contact->out_path, len) != 0)) {
+    MESH_DEBUG_PRINTLN("handlePathFailover: switching path, len %d -> %d", (int) contact->out_path_len, len);
+    memcpy(contact->out_path, path, contact->out_path_len = len);
+    contact->lastmod = getRTCClock()->getCurrentTime();
+    onContactPathUpdated(*contact);
+  }
+}
+
+void BaseChatMesh::recordSendVer(const ContactInfo& recipient, const mesh::Packet* pkt) {
+  txt_send_v2 = pkt->isRouteFlood() && pkt->getPayloadVer() > PAYLOAD_VER_1;
+  if (txt_send_v2) memcpy(txt_send_v2_key, recipient.id.pub_key, PATH_KEY_PREFIX_SIZE);
+}
+
+void BaseChatMesh::handlePayloadVerFallback() {
+  // a newer version flood went unanswered, possibly because older repeaters drop it, so fall back to V1
+  auto contact = lookupContactByPubKey(txt_send_v2_key, PATH_KEY_PREFIX_SIZE);
+  if (contact == NULL) return;
+
+  MESH_DEBUG_PRINTLN("handlePayloadVerFallback: %s, falling back to V1", contact->name);
+  contact->max_payload_ver = PAYLOAD_VER_1;
+  if (contact->payload_ver != PAYLOAD_VER_1) {
+    resetPathTo(*contact);
+    contact->payload_ver = PAYLOAD_VER_1;
+    contact->lastmod = getRTCClock()->getCurrentTime();
+    onContactPathUpdated(*contact);
+  }
+}
+
 void BaseChatMesh::handleReturnPathRetry(const ContactInfo& contact, const uint8_t* path, uint8_t path_len) {
   // NOTE: simplest impl is just to re-send a reciprocal return path to sender (DIRECTLY)
   //        override this method in various firmwares, if there's a better strategy
-  mesh::Packet* rpath = createPathReturn(contact.id, contact.shared_secret, path, path_len, 0, NULL, 0);
+  mesh::Packet* rpath = createPathReturn(contact.id, contact.getSharedSecret(self_id), path, path_len, 0, NULL, 0, contact.payload_ver);
   if (rpath) sendDirect(rpath, contact.out_path, contact.out_path_len, 3000);   // 3 second delay
 }
 
 #ifdef MAX_GROUP_CHANNELS
 int BaseChatMesh::searchChannelsByHash(const uint8_t* hash, mesh::GroupChannel dest[], int max_matches) {
-  int n = 0;
-  for (int i = 0; i < MAX_GROUP_CHANNELS && n < max_matches; i++) {
-    if (channels[i].channel.hash[0] == hash[0]) {
-      dest[n++] = channels[i].channel;
+  // binary search for first indexed channel with this hash
+  int lo = 0, hi = num_indexed_channels;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (channels[channel_index[mid]].channel.hash[0] < hash[0]) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+
+  int n = 0;
+  while (lo < num_indexed_channels && n < max_matches && channels[channel_index[lo]].channel.hash[0] == hash[0]) {
+    dest[n++] = channels[channel_index[lo++]].channel;
+  }
   return n;
 }
+
+void BaseChatMesh::indexChannels() {
+  static uint8_t zeroes[PUB_KEY_SIZE];
+
+  num_indexed_channels = 0;
+  for (int i = 0; i < MAX_GROUP_CHANNELS; i++) {
+    if (memcmp(channels[i].channel.secret, zeroes, PUB_KEY_SIZE) == 0) continue;   // empty slot
+
+    // insertion sort, by hash
+    int j = num_indexed_channels++;
+    while (j > 0 && channels[channel_index[j - 1]].channel.hash[0] > channels[i].channel.hash[0]) {
+      channel_index[j] = channel_index[j - 1];
+      j--;
+    }
+    channel_index[j] = i;
+  }
+}
 #endif
 
 void BaseChatMesh::onGroupDataRecv(mesh::Packet* packet, uint8_t type, const mesh::GroupChannel& channel, uint8_t* data, size_t len) {
+  if (type == PAYLOAD_TYPE_GRP_TXT && len > 5 && ((data[4] >> 2) & TXT_FLAG_COMPRESSED)) {
+    len = TextCompressor::expandTxtPayload(data, len, MAX_PACKET_PAYLOAD);
+    if (len == 0) return;   // invalid
+  }
   uint8_t txt_type = data[4];
   if (type == PAYLOAD_TYPE_GRP_TXT && len > 5 && (txt_type >> 2) == 0) {  // 0 = plain text msg
     uint32_t timestamp;
@@ -322,13 +503,33 @@ mesh::Packet* BaseChatMesh::composeMsgPacket(const ContactInfo& recipient, uint3
   // calc expected ACK reply
   mesh::Utils::sha256((uint8_t *)&expected_ack, 4, temp, 5 + text_len, self_id.pub_key, PUB_KEY_SIZE);
 
+  // NOTE: only chat and room server firmware decode compressed text
+  uint8_t* payload = temp;
+  uint8_t packed[5+MAX_TEXT_LEN+2];
   int len = 5 + text_len;
+  if (recipient.canRecvCompressedText() && (recipient.type == ADV_TYPE_CHAT || recipient.type == ADV_TYPE_ROOM)) {
+    int tail = attempt > 3 ? 2 : 0;
+    int enc_len = TextCompressor::encode(&packed[5], text_len, text, text_len);
+    if (enc_len > 0 && (5 + enc_len + tail + CIPHER_BLOCK_SIZE-1) / CIPHER_BLOCK_SIZE < (len + tail + CIPHER_BLOCK_SIZE-1) / CIPHER_BLOCK_SIZE) {
+      // saves at least one cipher block (NOTE: expected_ack is still calc'd from the uncompressed text)
+      memcpy(packed, temp, 5);
+      packed[4] |= (TXT_FLAG_COMPRESSED << 2);
+      payload = packed;
+      len = 5 + enc_len;
+    }
+  }
   if (attempt > 3) {
-    temp[len++] = 0;  // null terminator
-    temp[len++] = attempt;  // hide attempt number at tail end of payload
+    payload[len++] = 0;  // null terminator
+    payload[len++] = attempt;  // hide attempt number at tail end of payload
   }
 
-  return createDatagram(PAYLOAD_TYPE_TXT_MSG, recipient.id, recipient.shared_secret, temp, len);
+  mesh::Packet* pkt = createDatagram(PAYLOAD_TYPE_TXT_MSG, recipient.id, recipient.getSharedSecret(self_id), payload, len, getSendPayloadVer(recipient));
+  if (pkt && attempt > 0) {
+    // this retry is redundant if ACK of the previous attempt arrives while it is still queued
+    temp[4] = ((attempt - 1) & 3);
+    mesh::Utils::sha256((uint8_t *)&pkt->_cancel_ack, 4, temp, 5 + text_len, self_id.pub_key, PUB_KEY_SIZE);
+  }
+  return pkt;
 }
 
 int  BaseChatMesh::sendMessage(const ContactInfo& recipient, uint32_t timestamp, uint8_t attempt, const char* text, uint32_t& expected_ack, uint32_t& est_timeout) {
@@ -341,12 +542,16 @@ int  BaseChatMesh::sendMessage(const ContactInfo& recipient, uint32_t timestamp,
   if (recipient.out_path_len < 0) {
     sendFlood(pkt);
     txt_send_timeout = futureMillis(est_timeout = calcFloodTimeoutMillisFor(t));
+    txt_send_expected_ack = 0;
     rc = MSG_SEND_SENT_FLOOD;
   } else {
     sendDirect(pkt, recipient.out_path, recipient.out_path_len);
     txt_send_timeout = futureMillis(est_timeout = calcDirectTimeoutMillisFor(t, recipient.out_path_len));
+    path_table.recordSend(recipient.id, recipient.out_path, recipient.out_path_len, expected_ack);
+    txt_send_expected_ack = expected_ack;
     rc = MSG_SEND_SENT_DIRECT;
   }
+  recordSendVer(recipient, pkt);
   return rc;
 }
 
@@ -359,7 +564,7 @@ int  BaseChatMesh::sendCommandData(const ContactInfo& recipient, uint32_t timest
   temp[4] = (attempt & 3) | (TXT_TYPE_CLI_DATA << 2);
   memcpy(&temp[5], text, text_len + 1);
 
-  auto pkt = createDatagram(PAYLOAD_TYPE_TXT_MSG, recipient.id, recipient.shared_secret, temp, 5 + text_len);
+  auto pkt = createDatagram(PAYLOAD_TYPE_TXT_MSG, recipient.id, recipient.getSharedSecret(self_id), temp, 5 + text_len, getSendPayloadVer(recipient));
   if (pkt == NULL) return MSG_SEND_FAILED;
 
   uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
@@ -367,12 +572,15 @@ int  BaseChatMesh::sendCommandData(const ContactInfo& recipient, uint32_t timest
   if (recipient.out_path_len < 0) {
     sendFlood(pkt);
     txt_send_timeout = futureMillis(est_timeout = calcFloodTimeoutMillisFor(t));
+    txt_send_expected_ack = 0;
     rc = MSG_SEND_SENT_FLOOD;
   } else {
     sendDirect(pkt, recipient.out_path, recipient.out_path_len);
     txt_send_timeout = futureMillis(est_timeout = calcDirectTimeoutMillisFor(t, recipient.out_path_len));
+    txt_send_expected_ack = 0;   // no ACK expected for CLI_DATA
     rc = MSG_SEND_SENT_DIRECT;
   }
+  recordSendVer(recipient, pkt);
   return rc;
 }
 
@@ -389,7 +597,19 @@ bool BaseChatMesh::sendGroupMessage(uint32_t timestamp, mesh::GroupChannel& chan
   memcpy(ep, text, text_len);
   ep[text_len] = 0;  // null terminator
 
-  auto pkt = createGroupDatagram(PAYLOAD_TYPE_GRP_TXT, channel, temp, 5 + prefix_len + text_len);
+  int len = 5 + prefix_len + text_len;
+#ifdef GROUP_TEXT_COMPRESSION
+  // NOTE: older firmware ignores compressed channel messages, so only enable when all channel members can decode them
+  uint8_t packed[5+MAX_TEXT_LEN+32];
+  int enc_len = TextCompressor::encode(&packed[5], prefix_len + text_len, (const char *) &temp[5], prefix_len + text_len);
+  if (enc_len > 0 && (5 + enc_len + CIPHER_BLOCK_SIZE-1) / CIPHER_BLOCK_SIZE < (len + CIPHER_BLOCK_SIZE-1) / CIPHER_BLOCK_SIZE) {
+    temp[4] = (TXT_FLAG_COMPRESSED << 2);   // TXT_TYPE_PLAIN
+    memcpy(&temp[5], &packed[5], enc_len);
+    len = 5 + enc_len;
+  }
+#endif
+
+  auto pkt = createGroupDatagram(PAYLOAD_TYPE_GRP_TXT, channel, temp, len);
   if (pkt) {
     sendFlood(pkt);
     return true;
@@ -446,7 +666,7 @@ int BaseChatMesh::sendLogin(const ContactInfo& recipient, const char* password,
       tlen = 4 + len;
     }
 
-    pkt = createAnonDatagram(PAYLOAD_TYPE_ANON_REQ, self_id, recipient.id, recipient.shared_secret, temp, tlen);
+    pkt = createAnonDatagram(PAYLOAD_TYPE_ANON_REQ, self_id, recipient.id, recipient.getSharedSecret(self_id), temp, tlen, getSendPayloadVer(recipient));
   }
   if (pkt) {
     uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
@@ -473,7 +693,7 @@ int  BaseChatMesh::sendRequest(const ContactInfo& recipient, const uint8_t* req_
     memcpy(temp, &tag, 4);   // mostly an extra blob to help make packet_hash unique
     memcpy(&temp[4], req_data, data_len);
 
-    pkt = createDatagram(PAYLOAD_TYPE_REQ, recipient.id, recipient.shared_secret, temp, 4 + data_len);
+    pkt = createDatagram(PAYLOAD_TYPE_REQ, recipient.id, recipient.getSharedSecret(self_id), temp, 4 + data_len, getSendPayloadVer(recipient));
   }
   if (pkt) {
     uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
@@ -500,7 +720,7 @@ int  BaseChatMesh::sendRequest(const ContactInfo& recipient, uint8_t req_type, u
     memset(&temp[5], 0, 4);  // reserved (possibly for 'since' param)
     getRNG()->random(&temp[9], 4);   // random blob to help make packet-hash unique
 
-    pkt = createDatagram(PAYLOAD_TYPE_REQ, recipient.id, recipient.shared_secret, temp, sizeof(temp));
+    pkt = createDatagram(PAYLOAD_TYPE_REQ, recipient.id, recipient.getSharedSecret(self_id), temp, sizeof(temp), getSendPayloadVer(recipient));
   }
   if (pkt) {
     uint32_t t = _radio->getEstAirtimeFor(pkt->getRawLength());
@@ -623,7 +843,7 @@ void BaseChatMesh::checkConnections() {
       // calc expected ACK reply
       mesh::Utils::sha256((uint8_t *)&connections[i].expected_ack, 4, data, 9, self_id.pub_key, PUB_KEY_SIZE);
 
-      auto pkt = createDatagram(PAYLOAD_TYPE_REQ, contact->id, contact->shared_secret, data, 9);
+      auto pkt = createDatagram(PAYLOAD_TYPE_REQ, contact->id, contact->getSharedSecret(self_id), data, 9, contact->payload_ver);
       if (pkt) {
         sendDirect(pkt, contact->out_path, contact->out_path_len);
       }
@@ -636,6 +856,7 @@ void BaseChatMesh::checkConnections() {
 
 void BaseChatMesh::resetPathTo(ContactInfo& recipient) {
   recipient.out_path_len = -1;
+  path_table.clearPaths(recipient.id);   // start afresh, with a new flood
 }
 
 static ContactInfo* table;  // pass via global :-(
@@ -686,9 +907,7 @@ bool BaseChatMesh::addContact(const ContactInfo& contact) {
   if (num_contacts < MAX_CONTACTS) {
     auto dest = &contacts[num_contacts++];
     *dest = contact;
-
-    // calc the ECDH shared secret (just once for performance)
-    self_id.calcSharedSecret(dest->shared_secret, contact.id);
+    dest->has_shared_secret = false;   // ECDH is deferred until first use, so loading all contacts at boot is quick
 
     return true;  // success
   }
@@ -702,6 +921,8 @@ bool BaseChatMesh::removeContact(ContactInfo& contact) {
   }
   if (idx >= num_contacts) return false;   // not found
 
+  path_table.clearPaths(contact.id);
+
   // remove from contacts array
   num_contacts--;
   while (idx < num_contacts) {
@@ -722,8 +943,10 @@ ChannelDetails* BaseChatMesh::addChannel(const char* name, const char* psk_base6
     int len = decode_base64((unsigned char *) psk_base64, strlen(psk_base64), dest->channel.secret);
     if (len == 32 || len == 16) {
       mesh::Utils::sha256(dest->channel.hash, sizeof(dest->channel.hash), dest->channel.secret, len);
+      mesh::Utils::initHMAC(dest->channel.hmac_state, dest->channel.secret, PUB_KEY_SIZE);
       StrHelper::strncpy(dest->name, name, sizeof(dest->name));
       num_channels++;
+      indexChannels();
       return dest;
     }
   }
@@ -746,6 +969,8 @@ bool BaseChatMesh::setChannel(int idx, const ChannelDetails& src) {
     } else {
       mesh::Utils::sha256(channels[idx].channel.hash, sizeof(channels[idx].channel.hash), src.channel.secret, 32);  // 256-bit key
     }
+    mesh::Utils::initHMAC(channels[idx].channel.hmac_state, src.channel.secret, PUB_KEY_SIZE);
+    indexChannels();
     return true;
   }
   return false;
@@ -791,11 +1016,20 @@ bool ContactsIterator::hasNext(const BaseChatMesh* mesh, ContactInfo& dest) {
 
 void BaseChatMesh::loop() {
   Mesh::loop();
+#ifdef WITH_FRAGMENT_TRANSFER
+  transfers.loop();
+#endif
 
   if (txt_send_timeout && millisHasNowPassed(txt_send_timeout)) {
     // failed to get an ACK
     onSendTimeout();
     txt_send_timeout = 0;
+
+    handlePathFailover(txt_send_expected_ack);
+    txt_send_expected_ack = 0;
+
+    if (txt_send_v2) handlePayloadVerFallback();
+    txt_send_v2 = false;
   }
 
   if (_pendingLoopback) {
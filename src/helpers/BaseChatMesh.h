@@ -8,6 +8,11 @@
 #define MAX_TEXT_LEN    (10*CIPHER_BLOCK_SIZE)  // must be LESS than (MAX_PACKET_PAYLOAD - 4 - CIPHER_MAC_SIZE - 1)
 
 #include "ContactInfo.h"
+#include "ContactPathTable.h"
+#include "AckLossTable.h"
+#ifdef WITH_FRAGMENT_TRANSFER
+  #include "FragmentTransfer.h"
+#endif
 
 #define MAX_SEARCH_RESULTS   8
 
@@ -41,6 +46,10 @@ public:
   #define MAX_CONNECTIONS  16
 #endif
 
+#ifndef MAX_PAYLOAD_VER
+  #define MAX_PAYLOAD_VER   PAYLOAD_VER_1    // highest version we will initiate (when contact supports it)
+#endif
+
 struct ConnectionInfo {
   mesh::Identity server_id;
   unsigned long next_ping;
@@ -54,7 +63,11 @@ struct ConnectionInfo {
 /**
  *  \brief  abstract Mesh class for common 'chat' client
  */
-class BaseChatMesh : public mesh::Mesh {
+class BaseChatMesh : public mesh::Mesh
+#ifdef WITH_FRAGMENT_TRANSFER
+    , public FragmentTransferHost
+#endif
+{
 
   friend class ContactsIterator;
 
@@ -63,32 +76,61 @@ class BaseChatMesh : public mesh::Mesh {
   int sort_array[MAX_CONTACTS];
   int matching_peer_indexes[MAX_SEARCH_RESULTS];
   unsigned long txt_send_timeout;
+  uint32_t txt_send_expected_ack;   // of last DIRECT sendMessage(), for scoring its path
+  uint8_t txt_send_v2_key[PATH_KEY_PREFIX_SIZE];   // recipient of last FLOOD send, if it was > PAYLOAD_VER_1
+  bool txt_send_v2;
+  ContactPathTable path_table;
+  AckLossTable ack_losses;
+#ifdef WITH_FRAGMENT_TRANSFER
+  FragmentTransfer transfers;   // NOTE: large RAM cost (send + recv buffers), so opt-in
+#endif
 #ifdef MAX_GROUP_CHANNELS
   ChannelDetails channels[MAX_GROUP_CHANNELS];
   int num_channels;  // only for addChannel()
+  uint8_t channel_index[MAX_GROUP_CHANNELS];   // idx of configured channels, sorted by hash (for searchChannelsByHash())
+  int num_indexed_channels;
 #endif
   mesh::Packet* _pendingLoopback;
   uint8_t temp_buf[MAX_TRANS_UNIT];
   ConnectionInfo connections[MAX_CONNECTIONS];
 
   mesh::Packet* composeMsgPacket(const ContactInfo& recipient, uint32_t timestamp, uint8_t attempt, const char *text, uint32_t& expected_ack);
-  void sendAckTo(const ContactInfo& dest, uint32_t ack_hash);
+  void sendAckTo(const ContactInfo& dest, uint32_t ack_hash, uint32_t msg_timestamp);
+  void handlePathFailover(uint32_t expected_ack);
+  void recordSendVer(const ContactInfo& recipient, const mesh::Packet* pkt);
+  void handlePayloadVerFallback();
+#ifdef MAX_GROUP_CHANNELS
+  void indexChannels();
+#endif
 
 protected:
   BaseChatMesh(mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc, mesh::PacketManager& mgr, mesh::MeshTables& tables)
       : mesh::Mesh(radio, ms, rng, rtc, mgr, tables)
+#ifdef WITH_FRAGMENT_TRANSFER
+      , transfers(*this, ms)
+#endif
   { 
     num_contacts = 0;
   #ifdef MAX_GROUP_CHANNELS
     memset(channels, 0, sizeof(channels));
     num_channels = 0;
+    num_indexed_channels = 0;
   #endif
     txt_send_timeout = 0;
+    txt_send_expected_ack = 0;
+    txt_send_v2 = false;
     _pendingLoopback = NULL;
     memset(connections, 0, sizeof(connections));
   }
 
   void resetContacts() { num_contacts = 0; }
+  int getAckLossPercent(const uint8_t* path, uint8_t path_len) const { return ack_losses.getLossPercent(path, path_len); }
+
+  /**
+   * \brief  the PAYLOAD_VER_* to use for packets to 'contact'. Must match format of out_path, if it is known,
+   *          otherwise the highest version both sides support (capped by MAX_PAYLOAD_VER)
+  */
+  uint8_t getSendPayloadVer(const ContactInfo& contact) const;
 
   // 'UI' concepts, for sub-classes to implement
   virtual bool isAutoAddEnabled() const { return true; }
@@ -105,6 +147,13 @@ protected:
   virtual void onChannelMessageRecv(const mesh::GroupChannel& channel, mesh::Packet* pkt, uint32_t timestamp, const char *text) = 0;
   virtual uint8_t onContactRequest(const ContactInfo& contact, uint32_t sender_timestamp, const uint8_t* data, uint8_t len, uint8_t* reply) = 0;
   virtual void onContactResponse(const ContactInfo& contact, const uint8_t* data, uint8_t len) = 0;
+
+  /**
+   * \brief  a RESPONSE which was too large for a single packet, and has been reassembled from MULTIPART fragments
+   *          (only with WITH_FRAGMENT_TRANSFER build flag).
+   *          NOTE: default impl just passes it to onContactResponse(), if it fits.
+  */
+  virtual void onContactLargeResponse(const ContactInfo& contact, const uint8_t* data, int len);
   virtual void handleReturnPathRetry(const ContactInfo& contact, const uint8_t* path, uint8_t path_len);
 
   // storage concepts, for sub-classes to override/implement
@@ -113,16 +162,25 @@ protected:
 
   // Mesh overrides
   void onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len) override;
-  int searchPeersByHash(const uint8_t* hash) override;
+  int resolveCompactAdvert(const uint8_t* key_prefix, const uint8_t* delta, int delta_len, mesh::Identity& id, uint8_t app_data[]) override;
+  void onPeerPayloadVerRecv(int sender_idx, uint8_t max_ver) override;
+  int searchPeersByHash(const uint8_t* hash, uint8_t hash_size) override;
   void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) override;
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
   bool onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) override;
   void onAckRecv(mesh::Packet* packet, uint32_t ack_crc) override;
+  void onTraceRecv(mesh::Packet* packet, uint32_t tag, uint32_t auth_code, uint8_t flags, const uint8_t* path_snrs, const uint8_t* path_hashes, uint8_t path_len) override;
 #ifdef MAX_GROUP_CHANNELS
   int searchChannelsByHash(const uint8_t* hash, mesh::GroupChannel channels[], int max_matches) override;
 #endif
   void onGroupDataRecv(mesh::Packet* packet, uint8_t type, const mesh::GroupChannel& channel, uint8_t* data, size_t len) override;
 
+#ifdef WITH_FRAGMENT_TRANSFER
+  // FragmentTransferHost overrides
+  uint32_t sendTransferPacket(const uint8_t* peer_key, uint8_t mp_header, const uint8_t* data, int len) override;
+  void onTransferRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* blob, int len) override;
+#endif
+
   // Connections
   bool startConnection(const ContactInfo& contact, uint16_t keep_alive_secs);
   void stopConnection(const uint8_t* pub_key);
@@ -24,14 +24,15 @@ void ClientACL::load(FILESYSTEM* _fs) {
       while (!full) {
         ClientInfo c;
         uint8_t pub_key[32];
-        uint8_t unused[2];
+        uint8_t unused;
 
         memset(&c, 0, sizeof(c));
 
         bool success = (file.read(pub_key, 32) == 32);
         success = success && (file.read((uint8_t *) &c.permissions, 1) == 1);
         success = success && (file.read((uint8_t *) &c.extra.room.sync_since, 4) == 4);
-        success = success && (file.read(unused, 2) == 2);
+        success = success && (file.read(&c.payload_ver, 1) == 1);   // was 'unused'
+        success = success && (file.read(&unused, 1) == 1);
         success = success && (file.read((uint8_t *)&c.out_path_len, 1) == 1);
         success = success && (file.read(c.out_path, 64) == 64);
         success = success && (file.read(c.shared_secret, PUB_KEY_SIZE) == PUB_KEY_SIZE);
@@ -39,6 +40,8 @@ void ClientACL::load(FILESYSTEM* _fs) {
         if (!success) break; // EOF
 
         c.id = mesh::Identity(pub_key);
+        if (c.payload_ver > PAYLOAD_VER_2) c.payload_ver = PAYLOAD_VER_1;
+        mesh::Utils::initHMAC(c.hmac_state, c.shared_secret, PUB_KEY_SIZE);
         if (num_clients < MAX_CLIENTS) {
           clients[num_clients++] = c;
         } else {
@@ -53,8 +56,7 @@ void ClientACL::load(FILESYSTEM* _fs) {
 void ClientACL::save(FILESYSTEM* _fs, bool (*filter)(ClientInfo*)) {
   File file = openWrite(_fs, "/s_contacts");
   if (file) {
-    uint8_t unused[2];
-    memset(unused, 0, sizeof(unused));
+    uint8_t unused = 0;
 
     for (int i = 0; i < num_clients; i++) {
       auto c = &clients[i];
@@ -63,7 +65,8 @@ void ClientACL::save(FILESYSTEM* _fs, bool (*filter)(ClientInfo*)) {
       bool success = (file.write(c->id.pub_key, 32) == 32);
       success = success && (file.write((uint8_t *) &c->permissions, 1) == 1);
       success = success && (file.write((uint8_t *) &c->extra.room.sync_since, 4) == 4);
-      success = success && (file.write(unused, 2) == 2);
+      success = success && (file.write(&c->payload_ver, 1) == 1);
+      success = success && (file.write(&unused, 1) == 1);
       success = success && (file.write((uint8_t *)&c->out_path_len, 1) == 1);
       success = success && (file.write(c->out_path, 64) == 64);
       success = success && (file.write(c->shared_secret, PUB_KEY_SIZE) == PUB_KEY_SIZE);
@@ -125,6 +128,7 @@ bool ClientACL::applyPermissions(const mesh::LocalIdentity& self_id, const uint8
 
     c->permissions = perms;  // update their permissions
     self_id.calcSharedSecret(c->shared_secret, pubkey);
+    mesh::Utils::initHMAC(c->hmac_state, c->shared_secret, PUB_KEY_SIZE);
   }
   return true;
 }
@@ -15,7 +15,10 @@ struct ClientInfo {
   uint8_t permissions;
   int8_t out_path_len;
   uint8_t out_path[MAX_PATH_SIZE];
+  uint8_t payload_ver;       // one of PAYLOAD_VER_*, format of 'out_path' and of replies to client
+  uint8_t max_payload_ver;   // highest PAYLOAD_VER_* client has advertised  (transient)
   uint8_t shared_secret[PUB_KEY_SIZE];
+  mesh::HMACState hmac_state;   // pre-computed from 'shared_secret'
   uint32_t last_timestamp;   // by THEIR clock  (transient)
   uint32_t last_activity;    // by OUR clock    (transient)
   union  {
@@ -29,6 +32,9 @@ struct ClientInfo {
   } extra;
   
   bool isAdmin() const { return (permissions & PERM_ACL_ROLE_MASK) == PERM_ACL_ADMIN; }
+  // must match format of out_path, if known, otherwise reply in kind
+  uint8_t getReplyPayloadVer(uint8_t in_ver) const { return out_path_len >= 0 ? payload_ver : in_ver; }
+  bool canRecvAckBundle() const { return max_payload_ver >= PAYLOAD_VER_2; }   // firmware new enough to understand PAYLOAD_TYPE_ACK_BUNDLE
 };
 
 #ifndef MAX_CLIENTS
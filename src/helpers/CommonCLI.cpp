@@ -58,6 +58,8 @@ void CommonCLI::loadPrefsInt(FILESYSTEM* fs, const char* filename) {
     file.read((uint8_t *) &_prefs->flood_max, sizeof(_prefs->flood_max));   // 124
     file.read((uint8_t *) &_prefs->flood_advert_interval, sizeof(_prefs->flood_advert_interval));  // 125
     file.read((uint8_t *) &_prefs->interference_threshold, sizeof(_prefs->interference_threshold));  // 126
+    file.read((uint8_t *) &_prefs->adaptive_adverts, sizeof(_prefs->adaptive_adverts));  // 127
+    file.read((uint8_t *) &_prefs->route_cache, sizeof(_prefs->route_cache));  // 128
 
     // sanitise bad pref values
     _prefs->rx_delay_base = constrain(_prefs->rx_delay_base, 0, 20.0f);
@@ -114,6 +116,8 @@ void CommonCLI::savePrefs(FILESYSTEM* fs) {
     file.write((uint8_t *) &_prefs->flood_max, sizeof(_prefs->flood_max));   // 124
     file.write((uint8_t *) &_prefs->flood_advert_interval, sizeof(_prefs->flood_advert_interval));  // 125
     file.write((uint8_t *) &_prefs->interference_threshold, sizeof(_prefs->interference_threshold));  // 126
+    file.write((uint8_t *) &_prefs->adaptive_adverts, sizeof(_prefs->adaptive_adverts));  // 127
+    file.write((uint8_t *) &_prefs->route_cache, sizeof(_prefs->route_cache));  // 128
 
     file.close();
   }
@@ -211,10 +215,14 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
         sprintf(reply, "> %d", (uint32_t) _prefs->multi_acks);
       } else if (memcmp(config, "allow.read.only", 15) == 0) {
         sprintf(reply, "> %s", _prefs->allow_read_only ? "on" : "off");
+      } else if (memcmp(config, "route.cache", 11) == 0) {
+        sprintf(reply, "> %s", _prefs->route_cache ? "on" : "off");
       } else if (memcmp(config, "flood.advert.interval", 21) == 0) {
         sprintf(reply, "> %d", ((uint32_t) _prefs->flood_advert_interval));
       } else if (memcmp(config, "advert.interval", 15) == 0) {
         sprintf(reply, "> %d", ((uint32_t) _prefs->advert_interval) * 2);
+      } else if (memcmp(config, "advert.adaptive", 15) == 0) {
+        sprintf(reply, "> %s", _prefs->adaptive_adverts ? "on" : "off");
       } else if (memcmp(config, "guest.password", 14) == 0) {
         sprintf(reply, "> %s", _prefs->guest_password);
       } else if (sender_timestamp == 0 && memcmp(config, "prv.key", 7) == 0) {  // from serial command line only
@@ -270,13 +278,17 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
         savePrefs();
         sprintf(reply, "OK - interval rounded to %d", ((uint32_t) _prefs->agc_reset_interval) * 4);
       } else if (memcmp(config, "multi.acks ", 11) == 0) {
-        _prefs->multi_acks = atoi(&config[11]);
+        _prefs->multi_acks = constrain(atoi(&config[11]), 0, 1);   // same range as when loaded
         savePrefs();
         strcpy(reply, "OK");
       } else if (memcmp(config, "allow.read.only ", 16) == 0) {
         _prefs->allow_read_only = memcmp(&config[16], "on", 2) == 0;
         savePrefs();
         strcpy(reply, "OK");
+      } else if (memcmp(config, "route.cache ", 12) == 0) {
+        _prefs->route_cache = memcmp(&config[12], "on", 2) == 0;
+        savePrefs();
+        strcpy(reply, "OK");
       } else if (memcmp(config, "flood.advert.interval ", 22) == 0) {
         int hours = _atoi(&config[22]);
         if ((hours > 0 && hours < 3) || (hours > 48)) {
@@ -297,6 +309,12 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
           savePrefs();
           strcpy(reply, "OK");
         }
+      } else if (memcmp(config, "advert.adaptive ", 16) == 0) {
+        _prefs->adaptive_adverts = memcmp(&config[16], "on", 2) == 0;
+        _callbacks->updateAdvertTimer();
+        _callbacks->updateFloodAdvertTimer();
+        savePrefs();
+        strcpy(reply, "OK");
       } else if (memcmp(config, "guest.password ", 15) == 0) {
         StrHelper::strncpy(_prefs->guest_password, &config[15], sizeof(_prefs->guest_password));
         savePrefs();
@@ -26,6 +26,8 @@ struct NodePrefs {  // persisted to file
     uint8_t flood_max;
     uint8_t interference_threshold;
     uint8_t agc_reset_interval;   // secs / 4
+    uint8_t adaptive_adverts;     // back off advert intervals while neighbourhood is stable
+    uint8_t route_cache;          // re-route floods DIRECT to well known destinations
 };
 
 class CommonCLICallbacks {
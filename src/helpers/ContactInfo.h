@@ -10,9 +10,26 @@ struct ContactInfo {
   uint8_t flags;
   int8_t out_path_len;
   uint8_t out_path[MAX_PATH_SIZE];
+  uint8_t payload_ver;       // one of PAYLOAD_VER_*, format of 'out_path' and of packets sent to contact
+  uint8_t max_payload_ver;   // highest PAYLOAD_VER_* contact has advertised  (transient)
   uint32_t last_advert_timestamp;   // by THEIR clock
-  uint8_t shared_secret[PUB_KEY_SIZE];
+  mutable uint8_t shared_secret[PUB_KEY_SIZE];   // NOTE: use getSharedSecret()
+  mutable bool has_shared_secret;       // (transient) false until above is calculated
   uint32_t lastmod;  // by OUR clock
   int32_t gps_lat, gps_lon;    // 6 dec places
   uint32_t sync_since;
+
+  /**
+   * \returns  the ECDH shared secret with this contact, calculated on first use
+  */
+  const uint8_t* getSharedSecret(const mesh::LocalIdentity& self_id) const {
+    if (!has_shared_secret) {
+      self_id.calcSharedSecret(shared_secret, id);
+      has_shared_secret = true;
+    }
+    return shared_secret;
+  }
+
+  bool canRecvAckBundle() const { return max_payload_ver >= PAYLOAD_VER_2; }   // firmware new enough to understand PAYLOAD_TYPE_ACK_BUNDLE
+  bool canRecvCompressedText() const { return max_payload_ver >= PAYLOAD_VER_2; }   // .. and TXT_FLAG_COMPRESSED
 };
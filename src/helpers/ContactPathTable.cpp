@@ -0,0 +1,231 @@
+#include "ContactPathTable.h"
+#include <string.h>
+
+#define SCORE_BASE             1000
+#define SCORE_PER_HOP            40
+#define SCORE_ACK_RATE          300   // scaled by ACK success rate (neutral = half)
+#define SCORE_PER_CONSEC_FAIL   200
+#define SCORE_UNVERIFIED        100
+#define STATS_AGE_THRESHOLD      32   // halve acks/fails when either reaches this, so recent outcomes dominate
+
+ContactPathTable::ContactPathTable() {
+  _use_counter = 0;
+  _next_pending = 0;
+  memset(_table, 0, sizeof(_table));
+  memset(_pending, 0, sizeof(_pending));
+}
+
+ContactPathTable::ContactPaths* ContactPathTable::lookup(const uint8_t* pub_key) {
+  for (int i = 0; i < MAX_MULTIPATH_CONTACTS; i++) {
+    auto e = &_table[i];
+    if (e->last_used && memcmp(e->key, pub_key, PATH_KEY_PREFIX_SIZE) == 0) {
+      e->last_used = ++_use_counter;
+      return e;
+    }
+  }
+  return NULL;  // not found
+}
+
+ContactPathTable::ContactPaths* ContactPathTable::getEntry(const uint8_t* pub_key) {
+  ContactPaths* e = lookup(pub_key);
+  if (e) return e;
+
+  e = &_table[0];
+  for (int i = 1; i < MAX_MULTIPATH_CONTACTS; i++) {   // find least recently used slot
+    if (_table[i].last_used < e->last_used) e = &_table[i];
+  }
+  memcpy(e->key, pub_key, PATH_KEY_PREFIX_SIZE);
+  for (int i = 0; i < MAX_PATHS_PER_CONTACT; i++) {
+    e->paths[i].path_len = -1;
+  }
+  e->last_used = ++_use_counter;
+  return e;
+}
+
+ContactPathTable::PathCandidate* ContactPathTable::findPath(ContactPaths* entry, const uint8_t* path, uint8_t path_len) {
+  for (int i = 0; i < MAX_PATHS_PER_CONTACT; i++) {
+    auto c = &entry->paths[i];
+    if (c->path_len == path_len && memcmp(c->path, path, path_len) == 0) return c;
+  }
+  return NULL;  // not found
+}
+
+int ContactPathTable::calcScore(const PathCandidate& c) {
+  int score = SCORE_BASE - SCORE_PER_HOP*(c.path_len / c.hash_size);
+  score += ((c.acks + 1) * SCORE_ACK_RATE) / (c.acks + c.fails + 2);
+  score -= SCORE_PER_CONSEC_FAIL*c.consec_fails;
+  if (c.min_snr != PATH_SNR_UNKNOWN) {
+    int snr = c.min_snr;   // SNR x 4, so 0 is break-even with an untested path
+    if (snr < -60) snr = -60;
+    if (snr > 40) snr = 40;
+    score += snr;
+  }
+  if ((c.src & PATH_SRC_RETURNED) == 0 && c.acks == 0) {
+    score -= SCORE_UNVERIFIED;
+  }
+  return score;
+}
+
+void ContactPathTable::ageStats(PathCandidate& c) {
+  if (c.acks >= STATS_AGE_THRESHOLD || c.fails >= STATS_AGE_THRESHOLD) {
+    c.acks >>= 1;
+    c.fails >>= 1;
+  }
+}
+
+void ContactPathTable::addPath(const mesh::Identity& id, const uint8_t* path, uint8_t path_len, uint8_t src, uint8_t hash_size) {
+  if (path_len > MAX_PATH_SIZE || hash_size == 0 || (path_len % hash_size) != 0) return;
+
+  auto e = getEntry(id.pub_key);
+  auto c = findPath(e, path, path_len);
+  if (c) {   // already a candidate
+    c->src |= src;
+    if (src & PATH_SRC_RETURNED) c->consec_fails = 0;   // fresh evidence it works
+    return;
+  }
+
+  PathCandidate fresh;
+  memset(&fresh, 0, sizeof(fresh));
+  fresh.path_len = path_len;
+  memcpy(fresh.path, path, path_len);
+  fresh.hash_size = hash_size;
+  fresh.src = src;
+  fresh.min_snr = PATH_SNR_UNKNOWN;
+
+  // use a free slot, otherwise replace the lowest scoring candidate (if worse than the new one)
+  PathCandidate* victim = NULL;
+  int victim_score = 0;
+  for (int i = 0; i < MAX_PATHS_PER_CONTACT; i++) {
+    auto p = &e->paths[i];
+    if (p->path_len < 0) { victim = p; break; }
+
+    int s = calcScore(*p);
+    if (victim == NULL || s < victim_score) {
+      victim = p;
+      victim_score = s;
+    }
+  }
+  if (victim->path_len >= 0 && (src & PATH_SRC_RETURNED) == 0 && victim_score >= calcScore(fresh)) {
+    return;   // existing candidates all look better
+  }
+  *victim = fresh;
+}
+
+void ContactPathTable::addReversedPath(const mesh::Identity& id, const uint8_t* in_path, uint8_t in_path_len, uint8_t hash_size) {
+  if (in_path_len > MAX_PATH_SIZE || hash_size == 0 || (in_path_len % hash_size) != 0) return;
+
+  uint8_t path[MAX_PATH_SIZE];
+  for (int i = 0, j = in_path_len - hash_size; j >= 0; i += hash_size, j -= hash_size) {   // reverse order of hops, not bytes
+    memcpy(&path[i], &in_path[j], hash_size);
+  }
+  addPath(id, path, in_path_len, PATH_SRC_REVERSED, hash_size);
+}
+
+void ContactPathTable::clearPaths(const mesh::Identity& id) {
+  auto e = lookup(id.pub_key);
+  if (e) {
+    e->last_used = 0;   // mark slot as free
+  }
+}
+
+void ContactPathTable::onTraceSNRs(const uint8_t* path_hashes, const uint8_t* path_snrs, uint8_t path_len) {
+  for (int i = 0; i < MAX_MULTIPATH_CONTACTS; i++) {
+    auto e = &_table[i];
+    if (e->last_used == 0) continue;
+
+    for (int j = 0; j < MAX_PATHS_PER_CONTACT; j++) {
+      auto c = &e->paths[j];
+      int hops = c->path_len > 0 ? c->path_len / c->hash_size : 0;
+      if (hops == 0 || hops > path_len) continue;
+
+      // trace hashes are PATH_HASH_SIZE, so compare against first byte of each candidate hop
+      int k;
+      for (k = 0; k < hops && c->path[k * c->hash_size] == path_hashes[k]; k++) ;
+      if (k < hops) continue;
+
+      // trace followed this path (as a prefix), so record the weakest hop
+      int8_t min_snr = (int8_t) path_snrs[0];
+      for (k = 1; k < hops; k++) {
+        if ((int8_t) path_snrs[k] < min_snr) min_snr = (int8_t) path_snrs[k];
+      }
+      c->min_snr = min_snr;
+    }
+  }
+}
+
+void ContactPathTable::recordSend(const mesh::Identity& id, const uint8_t* path, uint8_t path_len, uint32_t expected_ack) {
+  if (path_len > MAX_PATH_SIZE || expected_ack == 0) return;
+
+  auto p = &_pending[_next_pending];
+  _next_pending = (_next_pending + 1) % MAX_PENDING_PATH_ACKS;   // cyclic, oldest gets overwritten
+
+  p->ack_crc = expected_ack;
+  memcpy(p->key, id.pub_key, PATH_KEY_PREFIX_SIZE);
+  p->path_len = path_len;
+  memcpy(p->path, path, path_len);
+}
+
+bool ContactPathTable::onAckRecv(uint32_t ack_crc) {
+  for (int i = 0; i < MAX_PENDING_PATH_ACKS; i++) {
+    auto p = &_pending[i];
+    if (p->ack_crc == 0 || p->ack_crc != ack_crc) continue;
+
+    p->ack_crc = 0;  // consumed
+    auto e = lookup(p->key);
+    if (e == NULL) return true;
+
+    auto c = findPath(e, p->path, p->path_len);
+    if (c) {
+      if (c->acks < 255) c->acks++;
+      c->consec_fails = 0;
+      ageStats(*c);
+    }
+    return true;
+  }
+  return false;  // not one of ours
+}
+
+bool ContactPathTable::onAckTimeout(uint32_t expected_ack, uint8_t* pub_key_prefix) {
+  for (int i = 0; i < MAX_PENDING_PATH_ACKS; i++) {
+    auto p = &_pending[i];
+    if (p->ack_crc == 0 || p->ack_crc != expected_ack) continue;
+
+    p->ack_crc = 0;  // consumed
+    memcpy(pub_key_prefix, p->key, PATH_KEY_PREFIX_SIZE);
+
+    auto e = lookup(p->key);
+    if (e) {
+      auto c = findPath(e, p->path, p->path_len);
+      if (c) {
+        if (c->fails < 255) c->fails++;
+        if (c->consec_fails < MAX_PATH_CONSEC_FAILS) c->consec_fails++;
+        ageStats(*c);
+      }
+    }
+    return true;
+  }
+  return false;  // not one of ours
+}
+
+int ContactPathTable::selectBestPath(const uint8_t* pub_key, uint8_t* dest_path, bool allow_unverified) {
+  auto e = lookup(pub_key);
+  if (e == NULL) return -1;
+
+  PathCandidate* best = NULL;
+  int best_score = 0;
+  for (int i = 0; i < MAX_PATHS_PER_CONTACT; i++) {
+    auto c = &e->paths[i];
+    if (c->path_len < 0 || c->consec_fails >= MAX_PATH_CONSEC_FAILS) continue;
+    if (!allow_unverified && (c->src & PATH_SRC_RETURNED) == 0 && c->acks == 0) continue;
+
+    int s = calcScore(*c);
+    if (best == NULL || s > best_score) {
+      best = c;
+      best_score = s;
+    }
+  }
+  if (best == NULL) return -1;
+
+  memcpy(dest_path, best->path, best->path_len);
+  return best->path_len;
+}
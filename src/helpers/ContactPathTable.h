@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Mesh.h>
+
+#ifndef MAX_PATHS_PER_CONTACT
+  #define MAX_PATHS_PER_CONTACT     3
+#endif
+
+#ifndef MAX_MULTIPATH_CONTACTS
+  #define MAX_MULTIPATH_CONTACTS   16
+#endif
+
+#ifndef MAX_PENDING_PATH_ACKS
+  #define MAX_PENDING_PATH_ACKS     4
+#endif
+
+#ifndef MAX_PATH_CONSEC_FAILS
+  #define MAX_PATH_CONSEC_FAILS     3    // candidate is not used after this many successive ACK timeouts
+#endif
+
+#define PATH_SRC_RETURNED    0x01   // sent to us by the contact, in a PATH packet (ie. verified to work in that direction)
+#define PATH_SRC_REVERSED    0x02   // reverse of the in-path of a flood packet FROM the contact (unverified)
+
+#define PATH_KEY_PREFIX_SIZE   8
+
+#define PATH_SNR_UNKNOWN    -128
+
+/**
+ * \brief  Keeps several candidate out_paths per contact, scored by hop count, ACK success rate, and TRACE SNRs.
+ *         The contact's 'out_path' is then chosen as the best candidate, with fail-over to next best when
+ *         ACKs are not received.
+*/
+class ContactPathTable {
+  struct PathCandidate {
+    int8_t path_len;    // -1 if slot unused
+    uint8_t path[MAX_PATH_SIZE];
+    uint8_t hash_size;  // bytes per hop in 'path'
+    uint8_t src;        // one of PATH_SRC_*
+    uint8_t acks, fails;
+    uint8_t consec_fails;
+    int8_t min_snr;     // SNR x 4, weakest hop from last TRACE along this path, or PATH_SNR_UNKNOWN
+  };
+  struct ContactPaths {
+    uint8_t key[PATH_KEY_PREFIX_SIZE];
+    uint32_t last_used;   // zero if slot unused
+    PathCandidate paths[MAX_PATHS_PER_CONTACT];
+  };
+  struct PendingAck {
+    uint32_t ack_crc;   // zero if slot unused
+    uint8_t key[PATH_KEY_PREFIX_SIZE];
+    int8_t path_len;
+    uint8_t path[MAX_PATH_SIZE];
+  };
+
+  ContactPaths _table[MAX_MULTIPATH_CONTACTS];
+  PendingAck _pending[MAX_PENDING_PATH_ACKS];
+  int _next_pending;
+  uint32_t _use_counter;
+
+  ContactPaths* lookup(const uint8_t* pub_key);
+  ContactPaths* getEntry(const uint8_t* pub_key);    // lookup, or evict least recently used
+  PathCandidate* findPath(ContactPaths* entry, const uint8_t* path, uint8_t path_len);
+  static int calcScore(const PathCandidate& c);
+  static void ageStats(PathCandidate& c);
+
+public:
+  ContactPathTable();
+
+  /**
+   * \brief  adds a candidate path to contact (or refreshes an existing one). Lowest scored path is replaced if full.
+   * \param  src  one of PATH_SRC_*
+   * \param  hash_size  bytes per hop in 'path' (ie. Packet::hashSizeFor() the contact's payload_ver)
+  */
+  void addPath(const mesh::Identity& id, const uint8_t* path, uint8_t path_len, uint8_t src, uint8_t hash_size);
+
+  /**
+   * \brief  same as addPath(), but 'in_path' is from a flood packet received FROM contact, so is reversed (hop by hop) first.
+  */
+  void addReversedPath(const mesh::Identity& id, const uint8_t* in_path, uint8_t in_path_len, uint8_t hash_size);
+
+  /**
+   * \brief  forget all candidate paths to contact (eg. on reset path)
+  */
+  void clearPaths(const mesh::Identity& id);
+
+  /**
+   * \brief  record the per-hop SNRs of a TRACE against any candidate paths which it followed.
+   * \param  path_hashes  one PATH_HASH_SIZE hash per hop (candidate hops are matched on their first byte)
+   * \param  path_len  number of hops
+  */
+  void onTraceSNRs(const uint8_t* path_hashes, const uint8_t* path_snrs, uint8_t path_len);
+
+  /**
+   * \brief  remember which path a message was sent DIRECT on, so the outcome can be scored later.
+  */
+  void recordSend(const mesh::Identity& id, const uint8_t* path, uint8_t path_len, uint32_t expected_ack);
+
+  /**
+   * \brief  called when an ACK is received. Credits the path it was sent on.
+   * \returns  true if 'ack_crc' matched a recorded send
+  */
+  bool onAckRecv(uint32_t ack_crc);
+
+  /**
+   * \brief  called when no ACK was received in time. Penalises the path it was sent on.
+   * \param  pub_key_prefix  (output) first PATH_KEY_PREFIX_SIZE bytes of the contact's pub_key
+   * \returns  true if 'expected_ack' matched a recorded send
+  */
+  bool onAckTimeout(uint32_t expected_ack, uint8_t* pub_key_prefix);
+
+  /**
+   * \brief  choose the best scoring candidate path to contact.
+   * \param  allow_unverified  whether PATH_SRC_REVERSED only paths can be chosen
+   * \returns  length of path copied to 'dest_path', or -1 if no usable candidate
+  */
+  int selectBestPath(const uint8_t* pub_key, uint8_t* dest_path, bool allow_unverified);
+};
@@ -0,0 +1,77 @@
+#include "ErasureCode.h"
+#include <string.h>
+
+static bool isBitSet(const uint8_t* bitmap, int idx) { return (bitmap[idx >> 3] & (1 << (idx & 7))) != 0; }
+
+uint8_t ErasureCode::gfMul(uint8_t a, uint8_t b) {
+  uint8_t r = 0;
+  while (b) {
+    if (b & 1) r ^= a;
+    a = (a & 0x80) ? (a << 1) ^ 0x1D : (a << 1);   // GF(256), polynomial 0x11D
+    b >>= 1;
+  }
+  return r;
+}
+
+uint8_t ErasureCode::gfInv(uint8_t a) {
+  uint8_t r = 1;
+  for (int e = 254; e > 0; e >>= 1) {   // a^254 == a^-1
+    if (e & 1) r = gfMul(r, a);
+    a = gfMul(a, a);
+  }
+  return r;
+}
+
+void ErasureCode::addScaled(uint8_t* dest, const uint8_t* src, uint8_t coeff, int len) {
+  for (int i = 0; i < len; i++) {
+    dest[i] ^= gfMul(coeff, src[i]);
+  }
+}
+
+void ErasureCode::encodeRepair(uint8_t* dest, const uint8_t* data, int num_chunks, int chunk_size, int coded_idx) {
+  memset(dest, 0, chunk_size);
+  for (int i = 0; i < num_chunks; i++) {
+    addScaled(dest, &data[i * chunk_size], calcCoeff(coded_idx, i), chunk_size);
+  }
+}
+
+bool ErasureCode::decode(uint8_t* data, int num_chunks, int chunk_size, const uint8_t* received,
+                         uint8_t* repair, const uint8_t* repair_idx, int num_repair) {
+  // which data chunks are missing?
+  uint8_t missing[FRAG_MAX_REPAIR];
+  int n = 0;
+  for (int i = 0; i < num_chunks; i++) {
+    if (isBitSet(received, i)) continue;
+    if (n >= num_repair || n >= FRAG_MAX_REPAIR) return false;   // not enough repair chunks (yet)
+    missing[n++] = i;
+  }
+
+  // take the known data chunks out of each repair chunk, leaving n equations in the n missing chunks
+  uint8_t m[FRAG_MAX_REPAIR][FRAG_MAX_REPAIR];
+  for (int a = 0; a < n; a++) {
+    int x = repair_idx[a];
+    for (int i = 0; i < num_chunks; i++) {
+      if (isBitSet(received, i)) addScaled(&repair[a * chunk_size], &data[i * chunk_size], calcCoeff(x, i), chunk_size);
+    }
+    for (int b = 0; b < n; b++) m[a][b] = calcCoeff(x, missing[b]);
+  }
+
+  // Gauss-Jordan elimination (a Cauchy matrix is always invertible, so no pivoting needed)
+  for (int c = 0; c < n; c++) {
+    uint8_t inv = gfInv(m[c][c]);
+    uint8_t* rc = &repair[c * chunk_size];
+    for (int j = 0; j < n; j++) m[c][j] = gfMul(m[c][j], inv);
+    for (int i = 0; i < chunk_size; i++) rc[i] = gfMul(rc[i], inv);
+
+    for (int a = 0; a < n; a++) {
+      uint8_t f = m[a][c];
+      if (a == c || f == 0) continue;
+      for (int j = 0; j < n; j++) m[a][j] ^= gfMul(f, m[c][j]);
+      addScaled(&repair[a * chunk_size], rc, f, chunk_size);
+    }
+  }
+  for (int b = 0; b < n; b++) {
+    memcpy(&data[missing[b] * chunk_size], &repair[b * chunk_size], chunk_size);
+  }
+  return true;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifndef FRAG_MAX_REPAIR
+  #define FRAG_MAX_REPAIR        4    // max repair frags per coded transfer (receiver needs buffers for these)
+#endif
+
+/**
+ * \brief  Systematic erasure code over GF(256), polynomial 0x11D. k data chunks are extended by repair chunks
+ *         (coded_idx >= k), each a linear combination of all data chunks with Cauchy coefficients 1/(coded_idx ^ data_idx).
+ *         Any k of the chunks rebuild the data. Used by FragmentTransfer's coded mode, but has no other dependencies.
+*/
+class ErasureCode {
+public:
+  static uint8_t gfMul(uint8_t a, uint8_t b);
+  static uint8_t gfInv(uint8_t a);
+  static uint8_t calcCoeff(int coded_idx, int data_idx) { return gfInv(coded_idx ^ data_idx); }
+  static void addScaled(uint8_t* dest, const uint8_t* src, uint8_t coeff, int len);
+
+  /**
+   * \brief  computes repair chunk 'coded_idx' (must be >= num_chunks)
+   * \param  data  num_chunks consecutive chunks of chunk_size bytes (last one zero padded)
+  */
+  static void encodeRepair(uint8_t* dest, const uint8_t* data, int num_chunks, int chunk_size, int coded_idx);
+
+  /**
+   * \brief  rebuilds the missing data chunks in 'data', from the repair chunks
+   * \param  received  bitmap of the data chunks present in 'data'
+   * \param  repair  num_repair consecutive chunks of chunk_size bytes, with indexes repair_idx[]. Used as scratch.
+   * \returns  false if more data chunks are missing than num_repair (or FRAG_MAX_REPAIR)
+  */
+  static bool decode(uint8_t* data, int num_chunks, int chunk_size, const uint8_t* received,
+                     uint8_t* repair, const uint8_t* repair_idx, int num_repair);
+};
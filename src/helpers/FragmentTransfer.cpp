@@ -0,0 +1,297 @@
+#include "FragmentTransfer.h"
+#include <string.h>
+
+#define NO_PATH_RETRY_MILLIS   4000   // wait before re-trying, when host couldn't send (eg. no out_path yet)
+
+FragmentTransfer::FragmentTransfer(FragmentTransferHost& host, mesh::MillisecondClock& ms) : _host(&host), _ms(&ms) {
+  memset(&_send, 0, sizeof(_send));
+  for (int i = 0; i < MAX_RECV_TRANSFERS; i++) {
+    _recv[i].num_frags = 0;  // mark slot as unused
+  }
+}
+
+uint8_t* FragmentTransfer::allocSend(const uint8_t* peer_key, uint8_t type) {
+  if (_send.active) return NULL;  // busy
+
+  memcpy(_send.peer_key, peer_key, PUB_KEY_SIZE);
+  _send.type = type;
+  return _send.blob;
+}
+
+uint8_t FragmentTransfer::calcNumRepair(int num_frags) {
+  int n = (num_frags * FRAG_REPAIR_PERCENT + 99) / 100;
+  if (n < 1) n = 1;
+  if (n > FRAG_MAX_REPAIR) n = FRAG_MAX_REPAIR;
+  return n;
+}
+
+bool FragmentTransfer::startSend(int len, bool coded) {
+  if (_send.active || len < 4 || len > MAX_TRANSFER_SIZE) return false;
+
+  _send.len = len;
+  _send.num_frags = calcNumFrags(len);
+  _send.coded = coded;
+  _send.num_coded = coded ? _send.num_frags + calcNumRepair(_send.num_frags) : _send.num_frags;
+  memset(&_send.blob[len], 0, FRAG_BLOB_SIZE - len);   // pad last chunk
+  _send.next_new = 0;
+  _send.attempt = 0;
+  _send.retries = 0;
+  _send.last_req_idx = 0;
+  memset(_send.acked, 0, sizeof(_send.acked));
+  _send.active = true;
+
+  MESH_DEBUG_PRINTLN("FragmentTransfer: starting send, len=%d, frags=%d, coded=%d", len, (uint32_t) _send.num_frags, (uint32_t) _send.num_coded);
+  sendBurst();
+  return true;
+}
+
+uint32_t FragmentTransfer::sendFragment(int idx, bool status_req) {
+  uint8_t data[FRAG_MAX_PLAINTEXT];
+  memcpy(data, _send.blob, 4);   // transfer_id
+  data[4] = _send.len & 0xFF;
+  data[5] = _send.len >> 8;
+  data[6] = idx;
+  data[7] = (_send.attempt & 0x7F) | (status_req ? FRAG_FLAG_STATUS_REQ : 0);
+
+  int chunk_len;
+  if (idx < _send.num_frags) {
+    int offset = idx * FRAG_CHUNK_SIZE;
+    chunk_len = _send.len - offset;
+    if (chunk_len > FRAG_CHUNK_SIZE) chunk_len = FRAG_CHUNK_SIZE;
+    memcpy(&data[FRAG_DATA_HDR_SIZE], &_send.blob[offset], chunk_len);
+  } else {   // repair frag
+    chunk_len = FRAG_CHUNK_SIZE;
+    ErasureCode::encodeRepair(&data[FRAG_DATA_HDR_SIZE], _send.blob, _send.num_frags, FRAG_CHUNK_SIZE, idx);
+  }
+
+  uint8_t op = _send.coded ? FRAG_OP_CODED : FRAG_OP_DATA;
+  return _host->sendTransferPacket(_send.peer_key, (op << 4) | _send.type, data, FRAG_DATA_HDR_SIZE + chunk_len);
+}
+
+void FragmentTransfer::sendCodedBurst() {
+  // just the next frags in sequence, receiver doesn't need the gaps filled
+  int end = _send.next_new + FRAG_WINDOW_SIZE;
+  if (end > _send.num_coded) end = _send.num_coded;
+
+  _send.attempt++;
+  uint32_t total_timeout = 0;
+  int i;
+  for (i = _send.next_new; i < end; i++) {
+    uint32_t t = sendFragment(i, i == end - 1);
+    if (t == 0) break;
+    total_timeout += t;
+  }
+  _send.next_new = i;
+  _send.last_req_idx = end - 1;
+
+  _send.status_timeout = _ms->getMillis() + (i == end ? total_timeout : NO_PATH_RETRY_MILLIS);
+}
+
+void FragmentTransfer::sendBurst() {
+  if (_send.coded && _send.next_new < _send.num_coded) {
+    sendCodedBurst();
+    return;
+  }
+
+  // window starts at lowest un-acked fragment
+  int base = 0;
+  while (base < _send.num_frags && isBitSet(_send.acked, base)) base++;
+  int end = base + FRAG_WINDOW_SIZE;
+  if (end > _send.num_frags) end = _send.num_frags;
+
+  int last = -1;
+  for (int i = base; i < end; i++) {
+    if (!isBitSet(_send.acked, i)) last = i;
+  }
+  if (last < 0) return;   // nothing to send (shouldn't happen)
+
+  _send.attempt++;
+  uint32_t total_timeout = 0;
+  bool sent_all = true;
+  for (int i = base; i <= last; i++) {
+    if (isBitSet(_send.acked, i)) continue;  // receiver already has this one
+
+    uint32_t t = sendFragment(i, i == last);
+    if (t == 0) { sent_all = false; break; }
+    total_timeout += t;
+  }
+  if (last + 1 > _send.next_new) _send.next_new = last + 1;
+  _send.last_req_idx = last;
+
+  _send.status_timeout = _ms->getMillis() + (sent_all ? total_timeout : NO_PATH_RETRY_MILLIS);
+}
+
+void FragmentTransfer::finishSend(bool success) {
+  uint32_t id;
+  memcpy(&id, _send.blob, 4);
+  _send.active = false;
+
+  MESH_DEBUG_PRINTLN("FragmentTransfer: send %s, id=%u", success ? "complete" : "failed", id);
+  _host->onTransferSent(_send.peer_key, id, success);
+}
+
+void FragmentTransfer::onStatusRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* data, int len) {
+  if (!_send.active || type != _send.type || len < FRAG_STATUS_HDR_SIZE) return;
+  if (memcmp(peer_key, _send.peer_key, PUB_KEY_SIZE) != 0 || memcmp(data, _send.blob, 4) != 0) return;  // not for current send
+
+  uint8_t flags = data[6];
+  if (flags & FRAG_STATUS_REJECTED) {
+    finishSend(false);
+    return;
+  }
+  if (flags & FRAG_STATUS_COMPLETE) {
+    finishSend(true);
+    return;
+  }
+
+  int bitmap_len = len - FRAG_STATUS_HDR_SIZE;
+  if (bitmap_len > FRAG_BITMAP_SIZE) bitmap_len = FRAG_BITMAP_SIZE;
+  for (int i = 0; i < bitmap_len; i++) {
+    _send.acked[i] |= data[FRAG_STATUS_HDR_SIZE + i];
+  }
+
+  // only the reply to our latest burst drives the window, a stale STATUS just updates the bitmap
+  if (isBitSet(_send.acked, _send.last_req_idx)) {
+    _send.retries = 0;
+    sendBurst();   // re-send gaps, and slide window forward
+  }
+}
+
+FragmentTransfer::RecvState* FragmentTransfer::findRecv(const uint8_t* peer_key, uint32_t id) {
+  for (int i = 0; i < MAX_RECV_TRANSFERS; i++) {
+    auto r = &_recv[i];
+    if (r->num_frags && r->id == id && memcmp(r->peer_key, peer_key, PUB_KEY_SIZE) == 0) return r;
+  }
+  return NULL;  // not found
+}
+
+FragmentTransfer::RecvState* FragmentTransfer::allocRecv() {
+  RecvState* oldest_done = NULL;
+  for (int i = 0; i < MAX_RECV_TRANSFERS; i++) {
+    auto r = &_recv[i];
+    if (r->num_frags == 0) return r;   // free slot
+
+    if (r->complete && (oldest_done == NULL || (long)(r->last_activity - oldest_done->last_activity) < 0)) {
+      oldest_done = r;
+    }
+  }
+  return oldest_done;   // can recycle a completed one, otherwise NULL
+}
+
+void FragmentTransfer::sendStatus(const uint8_t* peer_key, uint8_t type, uint32_t id, uint16_t total_len, uint8_t flags, uint8_t attempt, const uint8_t* bitmap, int bitmap_len) {
+  uint8_t data[FRAG_STATUS_HDR_SIZE + FRAG_BITMAP_SIZE];
+  memcpy(data, &id, 4);
+  data[4] = total_len & 0xFF;
+  data[5] = total_len >> 8;
+  data[6] = flags;
+  data[7] = attempt;   // so a re-sent STATUS has a different packet hash
+  if (bitmap_len > 0) memcpy(&data[FRAG_STATUS_HDR_SIZE], bitmap, bitmap_len);
+
+  _host->sendTransferPacket(peer_key, (FRAG_OP_STATUS << 4) | type, data, FRAG_STATUS_HDR_SIZE + bitmap_len);
+}
+
+void FragmentTransfer::onDataRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* data, int len, bool coded) {
+  if (len < FRAG_DATA_HDR_SIZE) return;
+
+  uint32_t id;
+  memcpy(&id, data, 4);
+  uint16_t total_len = data[4] | (data[5] << 8);
+  uint8_t idx = data[6];
+  bool status_req = (data[7] & FRAG_FLAG_STATUS_REQ) != 0;
+  uint8_t attempt = data[7] & 0x7F;
+
+  if (total_len > MAX_TRANSFER_SIZE) {
+    MESH_DEBUG_PRINTLN("FragmentTransfer: transfer too large, len=%d", (uint32_t) total_len);
+    sendStatus(peer_key, type, id, total_len, FRAG_STATUS_REJECTED, attempt, NULL, 0);
+    return;
+  }
+  uint8_t num_frags = calcNumFrags(total_len);
+  if (total_len < 4 || idx >= num_frags + (coded ? FRAG_MAX_REPAIR : 0)) return;   // invalid (or more repair frags than we can use)
+
+  int offset = idx * FRAG_CHUNK_SIZE;
+  int chunk_len = FRAG_CHUNK_SIZE;
+  if (idx < num_frags && total_len - offset < chunk_len) chunk_len = total_len - offset;
+  if (len < FRAG_DATA_HDR_SIZE + chunk_len) return;   // truncated
+
+  auto r = findRecv(peer_key, id);
+  if (r == NULL) {
+    r = allocRecv();
+    if (r == NULL) {
+      MESH_DEBUG_PRINTLN("FragmentTransfer: no free recv slots");
+      sendStatus(peer_key, type, id, total_len, FRAG_STATUS_REJECTED, attempt, NULL, 0);
+      return;
+    }
+    memcpy(r->peer_key, peer_key, PUB_KEY_SIZE);
+    r->id = id;
+    r->type = type;
+    r->complete = false;
+    r->coded = coded;
+    r->len = total_len;
+    r->num_frags = num_frags;
+    r->num_data = r->num_repair = 0;
+    memset(r->received, 0, sizeof(r->received));
+    memset(&r->blob[total_len], 0, num_frags * FRAG_CHUNK_SIZE - total_len);   // padding of last chunk, for decode()
+  } else if (r->len != total_len || r->type != type || r->coded != coded) {
+    return;   // inconsistent with earlier fragments
+  }
+  r->last_activity = _ms->getMillis();
+
+  int bitmap_len = (r->num_frags + (r->coded ? FRAG_MAX_REPAIR : 0) + 7) / 8;
+  if (r->complete) {   // duplicate, sender must have missed our final STATUS
+    if (status_req) sendStatus(peer_key, type, id, total_len, FRAG_STATUS_COMPLETE, attempt, r->received, bitmap_len);
+    return;
+  }
+
+  if (!isBitSet(r->received, idx)) {
+    if (idx < r->num_frags) {
+      memcpy(&r->blob[offset], &data[FRAG_DATA_HDR_SIZE], chunk_len);
+      r->num_data++;
+    } else {   // repair frag, keep for decode()
+      memcpy(r->repair[r->num_repair], &data[FRAG_DATA_HDR_SIZE], chunk_len);
+      r->repair_idx[r->num_repair++] = idx;
+    }
+    setBit(r->received, idx);
+  }
+
+  if (r->num_data == r->num_frags || (r->num_data + r->num_repair >= r->num_frags
+        && ErasureCode::decode(r->blob, r->num_frags, FRAG_CHUNK_SIZE, r->received, &r->repair[0][0], r->repair_idx, r->num_repair))) {
+    r->complete = true;
+    sendStatus(peer_key, type, id, total_len, FRAG_STATUS_COMPLETE, attempt, r->received, bitmap_len);
+    _host->onTransferRecv(r->peer_key, r->type, r->blob, r->len);
+  } else if (status_req) {
+    sendStatus(peer_key, type, id, total_len, 0, attempt, r->received, bitmap_len);
+  }
+}
+
+void FragmentTransfer::onPacketRecv(const uint8_t* peer_key, const uint8_t* data, int len) {
+  if (len < 1) return;
+
+  uint8_t op = data[0] >> 4;
+  uint8_t type = data[0] & 0x0F;
+  if (type != PAYLOAD_TYPE_REQ && type != PAYLOAD_TYPE_RESPONSE) return;
+
+  if (op == FRAG_OP_DATA || op == FRAG_OP_CODED) {
+    onDataRecv(peer_key, type, &data[1], len - 1, op == FRAG_OP_CODED);
+  } else if (op == FRAG_OP_STATUS) {
+    onStatusRecv(peer_key, type, &data[1], len - 1);
+  }
+}
+
+void FragmentTransfer::loop() {
+  if (_send.active && hasPassed(_send.status_timeout)) {
+    if (++_send.retries > FRAG_MAX_RETRIES) {
+      finishSend(false);
+    } else {
+      MESH_DEBUG_PRINTLN("FragmentTransfer: status timeout, re-sending (retry %d)", (uint32_t) _send.retries);
+      sendBurst();
+    }
+  }
+
+  for (int i = 0; i < MAX_RECV_TRANSFERS; i++) {
+    auto r = &_recv[i];
+    if (r->num_frags && hasPassed(r->last_activity + FRAG_RECV_EXPIRY_MILLIS)) {
+      MESH_DEBUG_PRINTLN("FragmentTransfer: recv expired, id=%u, complete=%d", r->id, r->complete ? 1 : 0);
+      r->num_frags = 0;  // free the slot
+    }
+  }
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <Mesh.h>
+#include "ErasureCode.h"
+
+/*
+ * A blob larger than MAX_PACKET_PAYLOAD is sent as a sequence of PAYLOAD_TYPE_MULTIPART packets (see Mesh::createMultipartDatagram()).
+ *   multipart header byte:  (FRAG_OP_* << 4) | PAYLOAD_TYPE_REQ or PAYLOAD_TYPE_RESPONSE
+ *
+ *   FRAG_OP_DATA, encrypted:    transfer_id(4) | total_len(2) | frag_idx(1) | flags(1) | chunk
+ *   FRAG_OP_STATUS, encrypted:  transfer_id(4) | total_len(2) | flags(1) | attempt(1) | bitmap of received frags
+ *   FRAG_OP_CODED, encrypted:   same as FRAG_OP_DATA, but frag_idx >= k (num of data frags) are repair frags
+ *
+ * The transfer_id is the first 4 bytes of the blob (ie. the tag/timestamp of the REQ/RESPONSE).
+ * Sender keeps up to FRAG_WINDOW_SIZE fragments in flight, and asks for a STATUS on the last one of each burst.
+ * Missing fragments (gaps in the bitmap) are re-sent, and the burst is re-sent if no STATUS arrives in time.
+ * A STATUS echoes the attempt num of the fragment it replies to, so a repeated STATUS (eg. with an unchanged bitmap)
+ * isn't a duplicate packet, which would be dropped by hasSeen() along the way.
+ *
+ * Coded (bulk) mode: the k data frags are followed by r repair frags, each a linear combination of all data frags over
+ * GF(256), with Cauchy coefficients 1/(frag_idx ^ data_idx), see ErasureCode. The receiver can rebuild the blob from ANY
+ * k of the k+r frags, so the sender just moves on to the next burst, instead of re-sending gaps. Only when all k+r have been sent, and the
+ * receiver still can't decode, are missing data frags re-sent (as above).
+*/
+
+#define FRAG_OP_DATA       1
+#define FRAG_OP_STATUS     2
+#define FRAG_OP_CODED      3
+
+#define FRAG_FLAG_STATUS_REQ    0x80   // (DATA) sender wants a STATUS reply. Lower 7 bits are attempt num.
+#define FRAG_STATUS_COMPLETE    0x01   // (STATUS) all fragments received
+#define FRAG_STATUS_REJECTED    0x02   // (STATUS) receiver can't accept this transfer (too large, or busy)
+
+#define FRAG_DATA_HDR_SIZE    8
+#define FRAG_STATUS_HDR_SIZE  8
+
+// max plaintext in a multipart datagram: must allow for header byte, V2 hashes + MAC, and cipher block padding
+#define FRAG_MAX_PLAINTEXT  (MAX_PACKET_PAYLOAD - 1 - 2*MAX_PATH_HASH_SIZE - MAX_CIPHER_MAC_SIZE - (CIPHER_BLOCK_SIZE-1))
+#define FRAG_CHUNK_SIZE     (FRAG_MAX_PLAINTEXT - FRAG_DATA_HDR_SIZE)
+
+#ifndef MAX_TRANSFER_SIZE
+  #define MAX_TRANSFER_SIZE    2048
+#endif
+
+#ifndef FRAG_REPAIR_PERCENT
+  #define FRAG_REPAIR_PERCENT   25    // repair frags to send, as percentage of data frags (at least one)
+#endif
+
+#define MAX_TRANSFER_FRAGS   ((MAX_TRANSFER_SIZE + FRAG_CHUNK_SIZE-1) / FRAG_CHUNK_SIZE)
+#define FRAG_BITMAP_SIZE     ((MAX_TRANSFER_FRAGS + FRAG_MAX_REPAIR + 7) / 8)
+#define FRAG_BLOB_SIZE       (MAX_TRANSFER_FRAGS * FRAG_CHUNK_SIZE)   // whole chunks, last is zero padded (for coding)
+
+#if MAX_TRANSFER_FRAGS + FRAG_MAX_REPAIR > 255 || FRAG_STATUS_HDR_SIZE + FRAG_BITMAP_SIZE > FRAG_MAX_PLAINTEXT
+  #error "MAX_TRANSFER_SIZE is too large"
+#endif
+
+#ifndef MAX_RECV_TRANSFERS
+  #define MAX_RECV_TRANSFERS     2
+#endif
+
+#ifndef FRAG_WINDOW_SIZE
+  #define FRAG_WINDOW_SIZE       4
+#endif
+
+#ifndef FRAG_MAX_RETRIES
+  #define FRAG_MAX_RETRIES       4    // successive STATUS timeouts, before sender gives up
+#endif
+
+#ifndef FRAG_RECV_EXPIRY_MILLIS
+  #define FRAG_RECV_EXPIRY_MILLIS   60000   // incomplete (or completed) receive is forgotten after this idle time
+#endif
+
+/**
+ * \brief  callbacks for FragmentTransfer, typically implemented by the Mesh sub-class.
+*/
+class FragmentTransferHost {
+public:
+  /**
+   * \brief  send a multipart datagram (DIRECT) to peer, eg. via Mesh::createMultipartDatagram()
+   * \returns  estimated round-trip timeout (millis), or zero if it could not be sent (eg. no out_path yet)
+  */
+  virtual uint32_t sendTransferPacket(const uint8_t* peer_key, uint8_t mp_header, const uint8_t* data, int len) = 0;
+
+  /**
+   * \brief  a complete blob has been received from peer
+   * \param  type  PAYLOAD_TYPE_REQ or PAYLOAD_TYPE_RESPONSE
+  */
+  virtual void onTransferRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* blob, int len) = 0;
+
+  /**
+   * \brief  the transfer started by startSend() has finished
+  */
+  virtual void onTransferSent(const uint8_t* peer_key, uint32_t transfer_id, bool success) { }
+};
+
+/**
+ * \brief  Fragmentation and reassembly of REQ/RESPONSE blobs up to MAX_TRANSFER_SIZE bytes, with a sliding window
+ *         and bitmap (selective) acknowledgements. One outbound transfer at a time, up to MAX_RECV_TRANSFERS inbound.
+*/
+class FragmentTransfer {
+  struct SendState {
+    uint8_t peer_key[PUB_KEY_SIZE];
+    uint8_t type;
+    bool active;
+    bool coded;
+    uint16_t len;
+    uint8_t num_frags;
+    uint8_t num_coded;    // num_frags + repair frags (coded mode only)
+    uint8_t next_new;     // lowest fragment idx not yet sent
+    uint8_t last_req_idx; // fragment which carried the latest STATUS request
+    uint8_t attempt;
+    uint8_t retries;
+    uint8_t acked[FRAG_BITMAP_SIZE];
+    unsigned long status_timeout;
+    uint8_t blob[FRAG_BLOB_SIZE];
+  };
+  struct RecvState {
+    uint8_t peer_key[PUB_KEY_SIZE];
+    uint32_t id;
+    uint8_t type;
+    bool complete;
+    bool coded;
+    uint16_t len;
+    uint8_t num_frags;    // zero if slot unused
+    uint8_t num_data;     // data frags received so far
+    uint8_t num_repair;   // repair frags held in 'repair'
+    uint8_t repair_idx[FRAG_MAX_REPAIR];
+    uint8_t received[FRAG_BITMAP_SIZE];
+    unsigned long last_activity;
+    uint8_t blob[FRAG_BLOB_SIZE];
+    uint8_t repair[FRAG_MAX_REPAIR][FRAG_CHUNK_SIZE];
+  };
+
+  FragmentTransferHost* _host;
+  mesh::MillisecondClock* _ms;
+  SendState _send;
+  RecvState _recv[MAX_RECV_TRANSFERS];
+
+  static bool isBitSet(const uint8_t* bitmap, int idx) { return (bitmap[idx >> 3] & (1 << (idx & 7))) != 0; }
+  static void setBit(uint8_t* bitmap, int idx) { bitmap[idx >> 3] |= (1 << (idx & 7)); }
+  static uint8_t calcNumFrags(int len) { return (len + FRAG_CHUNK_SIZE-1) / FRAG_CHUNK_SIZE; }
+  bool hasPassed(unsigned long timestamp) const { return (long)(_ms->getMillis() - timestamp) > 0; }
+
+  static uint8_t calcNumRepair(int num_frags);
+
+  uint32_t sendFragment(int idx, bool status_req);
+  void sendBurst();
+  void sendCodedBurst();
+  void onStatusRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* data, int len);
+  void onDataRecv(const uint8_t* peer_key, uint8_t type, const uint8_t* data, int len, bool coded);
+  void sendStatus(const uint8_t* peer_key, uint8_t type, uint32_t id, uint16_t total_len, uint8_t flags, uint8_t attempt, const uint8_t* bitmap, int bitmap_len);
+  RecvState* findRecv(const uint8_t* peer_key, uint32_t id);
+  RecvState* allocRecv();
+  void finishSend(bool success);
+
+public:
+  FragmentTransfer(FragmentTransferHost& host, mesh::MillisecondClock& ms);
+
+  /**
+   * \returns  buffer (of MAX_TRANSFER_SIZE bytes) to fill with the blob to send to peer, or NULL if a send is in progress
+   * \param  type  PAYLOAD_TYPE_REQ or PAYLOAD_TYPE_RESPONSE
+  */
+  uint8_t* allocSend(const uint8_t* peer_key, uint8_t type);
+
+  /**
+   * \brief  begins sending the blob in the buffer returned by allocSend(). First 4 bytes are the transfer_id.
+   * \param  coded  send in coded (bulk) mode, with repair frags. Peer must support FRAG_OP_CODED.
+   * \returns  false if 'len' is invalid
+  */
+  bool startSend(int len, bool coded=false);
+
+  bool isSendBusy() const { return _send.active; }
+
+  /**
+   * \brief  process a decrypted PAYLOAD_TYPE_MULTIPART from peer (ie. from Mesh::onPeerDataRecv())
+   * \param  data  data[0] is the multipart header byte
+  */
+  void onPacketRecv(const uint8_t* peer_key, const uint8_t* data, int len);
+
+  void loop();
+};
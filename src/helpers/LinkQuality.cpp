@@ -0,0 +1,29 @@
+#include "LinkQuality.h"
+
+uint16_t LinkQuality::getETX() const {
+  uint32_t prr;   // x 255*255
+  if (has & LINK_HAS_RT) {
+    prr = (uint32_t)rt * 255;
+  } else if (has & LINK_HAS_REV) {
+    prr = (uint32_t)rev * ((has & LINK_HAS_FWD) ? fwd : rev);   // assume symmetric, if no fwd samples yet
+  } else if (has & LINK_HAS_FWD) {
+    prr = (uint32_t)fwd * fwd;
+  } else {
+    return LINK_ETX_UNKNOWN;
+  }
+  if (prr * LINK_ETX_MAX < 255*255*100) return LINK_ETX_MAX;
+
+  return (uint16_t)((255*255*100 + prr/2) / prr);
+}
+
+uint8_t LinkQuality::prrFromSNR(float snr, uint8_t sf) {
+  if (sf < 7) sf = 7;
+  if (sf > 12) sf = 12;
+  float floor = -7.5f - 2.5f*(sf - 7);   // demodulation floor, dB
+  float margin = snr - floor;
+
+  // roughly: 5% at 3dB below the floor, up to 100% at 5dB above
+  if (margin <= -3.0f) return 13;
+  if (margin >= 5.0f) return 255;
+  return (uint8_t)(13 + (margin + 3.0f) * (255 - 13) / 8.0f);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+#define LINK_ETX_UNKNOWN      0xFFFF
+#define LINK_ETX_MAX          2000     // x 100, ie. 20 transmissions
+
+#define LINK_HAS_RT           0x01
+#define LINK_HAS_FWD          0x02
+#define LINK_HAS_REV          0x04
+
+/**
+ * \brief  Link quality estimate for a single neighbour, as exponentially weighted moving averages (alpha = 1/8)
+ *         of packet reception ratios (0..255):
+ *           rt   round trip: we sent a DIRECT packet via them, and heard them forward it (implicit ACK)
+ *           fwd  us -> them: estimated from the SNR they measured (TRACE)
+ *           rev  them -> us: estimated from the SNR of packets heard from them (incl. duplicates)
+ *         ETX (expected transmission count) is 1/rt when there are round trip samples, otherwise 1/(fwd * rev).
+*/
+struct LinkQuality {
+  uint8_t rt, fwd, rev;
+  uint8_t has;   // LINK_HAS_* bits
+
+  void clear() { rt = fwd = rev = has = 0; }
+
+  void addRoundTrip(bool success) { update(rt, success ? 255 : 0, LINK_HAS_RT); }
+  void addFwdSNR(float snr, uint8_t sf) { update(fwd, prrFromSNR(snr, sf), LINK_HAS_FWD); }
+  void addRevSNR(float snr, uint8_t sf) { update(rev, prrFromSNR(snr, sf), LINK_HAS_REV); }
+
+  /**
+   * \returns  the ETX x 100 (100 is a perfect link), up to LINK_ETX_MAX, or LINK_ETX_UNKNOWN if no samples yet
+  */
+  uint16_t getETX() const;
+
+  /**
+   * \returns  estimated packet reception ratio (0..255), from SNR margin above the LoRa demodulation floor for 'sf'
+  */
+  static uint8_t prrFromSNR(float snr, uint8_t sf);
+
+private:
+  void update(uint8_t& ewma, uint8_t sample, uint8_t flag) {
+    if (has & flag) {
+      ewma = (uint8_t)(((uint16_t)ewma * 7 + sample + 4) / 8);
+    } else {
+      ewma = sample;   // first sample
+      has |= flag;
+    }
+  }
+};
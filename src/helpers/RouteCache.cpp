@@ -0,0 +1,59 @@
+#include "RouteCache.h"
+#include <string.h>
+
+void RouteCache::clear() {
+  memset(_entries, 0, sizeof(_entries));
+}
+
+void RouteCache::learn(const uint8_t* src_hash, uint8_t hash_size, const uint8_t* path, uint8_t path_len, uint32_t now) {
+  if (hash_size == 0 || hash_size > MAX_PATH_HASH_SIZE || path_len > MAX_PATH_SIZE || (path_len % hash_size) != 0) return;
+
+  // reverse the path, hop by hop
+  uint8_t rev[MAX_PATH_SIZE];
+  for (int i = 0, j = path_len - hash_size; j >= 0; i += hash_size, j -= hash_size) {
+    memcpy(&rev[i], &path[j], hash_size);
+  }
+
+  Entry* e = NULL;
+  Entry* victim = NULL;
+  for (int i = 0; i < ROUTE_CACHE_SIZE; i++) {
+    auto p = &_entries[i];
+    if (p->hash_size == 0) {
+      if (victim == NULL || victim->hash_size != 0) victim = p;   // prefer an unused slot
+    } else if (p->hash_size == hash_size && memcmp(p->hash, src_hash, hash_size) == 0) {
+      e = p;
+      break;
+    } else if (victim == NULL || (victim->hash_size != 0 && p->last_seen < victim->last_seen)) {
+      victim = p;   // least recently seen
+    }
+  }
+
+  if (e && e->path_len == path_len && memcmp(e->path, rev, path_len) == 0) {
+    if (e->hits < 255) e->hits++;   // same route again
+  } else {
+    if (e == NULL) {
+      e = victim;
+      e->hash_size = hash_size;
+      memcpy(e->hash, src_hash, hash_size);
+    }
+    e->hits = 1;   // new, or changed route
+    e->path_len = path_len;
+    memcpy(e->path, rev, path_len);
+  }
+  e->last_seen = now;
+}
+
+int RouteCache::lookup(const uint8_t* dest_hash, uint8_t hash_size, uint32_t now, uint8_t* path) const {
+  const Entry* found = NULL;
+  for (int i = 0; i < ROUTE_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->hash_size == hash_size && memcmp(e->hash, dest_hash, hash_size) == 0) {
+      if (found) return -1;   // ambiguous (shouldn't happen, as learn() only keeps one per hash)
+      found = e;
+    }
+  }
+  if (found == NULL || found->hits < ROUTE_CACHE_MIN_HITS || found->last_seen + ROUTE_CACHE_EXPIRY_SECS < now) return -1;
+
+  memcpy(path, found->path, found->path_len);
+  return found->path_len;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Mesh.h>
+
+#ifndef ROUTE_CACHE_SIZE
+  #define ROUTE_CACHE_SIZE          32
+#endif
+
+#ifndef ROUTE_CACHE_MIN_HITS
+  #define ROUTE_CACHE_MIN_HITS       2    // num of floods seen from a node via the same path, before route is trusted
+#endif
+
+#ifndef ROUTE_CACHE_EXPIRY_SECS
+  #define ROUTE_CACHE_EXPIRY_SECS   (30*60)
+#endif
+
+/**
+ * \brief  Remembers the reverse of the path each flood took from its sender (keyed by sender's hash), so that later
+ *         floods TO that node can be sent along a known route instead.
+*/
+class RouteCache {
+  struct Entry {
+    uint8_t hash[MAX_PATH_HASH_SIZE];
+    uint8_t hash_size;    // also the size of each hop in 'path', zero if slot unused
+    uint8_t hits;         // successive floods seen via this same path
+    uint8_t path_len;
+    uint8_t path[MAX_PATH_SIZE];   // from this node, TO the sender
+    uint32_t last_seen;   // by OUR clock
+  };
+  Entry _entries[ROUTE_CACHE_SIZE];
+
+public:
+  RouteCache() { clear(); }
+
+  void clear();
+
+  /**
+   * \brief  a flood from 'src_hash' has been received, via 'path'
+   * \param  hash_size  size of 'src_hash' and of each hop in 'path' (ie. Packet::getPathHashSize())
+  */
+  void learn(const uint8_t* src_hash, uint8_t hash_size, const uint8_t* path, uint8_t path_len, uint32_t now);
+
+  /**
+   * \param  path  OUT - the route to 'dest_hash' (MAX_PATH_SIZE)
+   * \returns  length of path (can be zero, ie. a direct neighbour), or -1 if no trusted route, or 'dest_hash' is ambiguous
+  */
+  int lookup(const uint8_t* dest_hash, uint8_t hash_size, uint32_t now, uint8_t* path) const;
+};
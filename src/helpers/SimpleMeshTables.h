@@ -41,6 +41,17 @@ public:
 #endif
 
   bool hasSeen(const mesh::Packet* packet) override {
+    uint8_t hash[MAX_HASH_SIZE];
+    if (packet->getPayloadType() != PAYLOAD_TYPE_ACK) {
+      packet->calculatePacketHash(hash);
+    }
+    return hasSeen(packet, hash);
+  }
+
+  /**
+   * \brief  same as hasSeen(packet), but with the packet hash already calculated (unused for ACKs)
+  */
+  bool hasSeen(const mesh::Packet* packet, const uint8_t* hash) {
     if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
       uint32_t ack;
       memcpy(&ack, packet->payload, 4);
@@ -60,9 +71,6 @@ public:
       return false;
     }
 
-    uint8_t hash[MAX_HASH_SIZE];
-    packet->calculatePacketHash(hash);
-
     const uint8_t* sp = _hashes;
     for (int i = 0; i < MAX_PACKET_HASHES; i++, sp += MAX_HASH_SIZE) {
       if (memcmp(hash, sp, MAX_HASH_SIZE) == 0) { 
@@ -104,6 +104,30 @@ mesh::Packet* StaticPoolPacketManager::getOutboundByIdx(int i) {
 mesh::Packet* StaticPoolPacketManager::removeOutboundByIdx(int i) {
   return send_queue.removeByIdx(i);
 }
+mesh::Packet* StaticPoolPacketManager::removeOutboundByHash(const uint8_t* hash) {
+  uint8_t h[MAX_HASH_SIZE];
+  for (int i = 0; i < send_queue.count(); i++) {
+    send_queue.itemAt(i)->calculatePacketHash(h);
+    if (memcmp(h, hash, MAX_HASH_SIZE) == 0) return send_queue.removeByIdx(i);
+  }
+  return NULL;  // not found
+}
+mesh::Packet* StaticPoolPacketManager::removeOutboundByAck(uint32_t ack_crc) {
+  for (int i = 0; i < send_queue.count(); i++) {
+    auto pkt = send_queue.itemAt(i);
+    if (pkt->_cancel_ack != 0 && pkt->_cancel_ack == ack_crc) return send_queue.removeByIdx(i);
+
+    uint8_t type = pkt->getPayloadType();
+    if (type == PAYLOAD_TYPE_ACK && pkt->payload_len >= 4 && memcmp(pkt->payload, &ack_crc, 4) == 0) {
+      return send_queue.removeByIdx(i);
+    }
+    if (type == PAYLOAD_TYPE_MULTIPART && pkt->payload_len >= 5 && (pkt->payload[0] & 0x0F) == PAYLOAD_TYPE_ACK
+        && memcmp(&pkt->payload[1], &ack_crc, 4) == 0) {
+      return send_queue.removeByIdx(i);
+    }
+  }
+  return NULL;  // not found
+}
 
 void StaticPoolPacketManager::queueInbound(mesh::Packet* packet, uint32_t scheduled_for) {
   rx_queue.add(packet, 0, scheduled_for);
@@ -32,6 +32,8 @@ public:
   int getFreeCount() const override;
   mesh::Packet* getOutboundByIdx(int i) override;
   mesh::Packet* removeOutboundByIdx(int i) override;
+  mesh::Packet* removeOutboundByHash(const uint8_t* hash) override;
+  mesh::Packet* removeOutboundByAck(uint32_t ack_crc) override;
   void queueInbound(mesh::Packet* packet, uint32_t scheduled_for) override;
   mesh::Packet* getNextInbound(uint32_t now) override;
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "TxtDataHelpers.h"
+#include <MeshCore.h>
+
+// NOTE: order only matters for the wire format, the encoder always picks the longest match
+static const char* const txt_dict[128] = {
+  " the", "the", " to", "ing", " a", " i", "e ", "s ", "t ", "th", "he", "in", "er", "an", "re", "on",
+  "at", "en", "nd", "ou", "ed", "ha", "to", "or", "it", "is", "hi", "es", "ng", " you", "you", " and",
+  " of", " is", " in", " it", " wh", " on", " be", " we", " so", " me", " no", " ok", "ll", "ve", "le", "st",
+  "ar", "al", "te", "se", "me", "ne", "ea", "ti", "as", "co", "ro", "ri", "li", "ra", "ma", "de",
+  "ch", "ur", "ly", "ow", "om", "ic", "el", "lo", "ca", "ce", "ge", "ent", "ion", "her", "for", " for",
+  "hat", " that", "all", "was", " hav", "ere", "thi", "ter", "est", "are", "ome", "ave", "not", "ight", "ould", " will",
+  "d ", "y ", "o ", "r ", ", ", ". ", "? ", "! ", "..", ":)", " I ", "I'm", "'s", "n't", "ss", "ee",
+  "oo", "un", "us", "ut", "ad", "am", "ay", "wi", "wa", "gh", "ing ", "ed ", "er ", " mesh", " can", "ok"
+};
+
+#define TXT_RAW_MAX   8
+
+static bool isTxtLiteral(uint8_t c) { return c > TXT_RAW_MAX && c < 0x80; }
+
+int TextCompressor::encode(uint8_t* dest, int dest_max, const char* src, int src_len) {
+  int o = 0, i = 0;
+  int raw_idx = -1;   // index in dest of current raw-run code byte
+  while (i < src_len) {
+    int best_len = 1, best = -1;
+    for (int k = 0; k < 128; k++) {
+      if (txt_dict[k][0] != src[i]) continue;
+      int n = strlen(txt_dict[k]);
+      if (n > best_len && n <= src_len - i && memcmp(txt_dict[k], &src[i], n) == 0) {
+        best = k;
+        best_len = n;
+      }
+    }
+    uint8_t c = src[i];
+    if (best >= 0) {
+      if (o + 1 > dest_max) return 0;
+      dest[o++] = 0x80 | best;
+      i += best_len;
+      raw_idx = -1;
+    } else if (isTxtLiteral(c)) {
+      if (o + 1 > dest_max) return 0;
+      dest[o++] = c;
+      i++;
+      raw_idx = -1;
+    } else {
+      if (c == 0) return 0;   // can't encode nulls
+      if (raw_idx < 0 || dest[raw_idx] == TXT_RAW_MAX) {   // start a new raw run
+        if (o + 2 > dest_max) return 0;
+        raw_idx = o;
+        dest[o++] = 0;
+      } else {
+        if (o + 1 > dest_max) return 0;
+      }
+      dest[raw_idx]++;
+      dest[o++] = c;
+      i++;
+    }
+  }
+  return o;
+}
+
+int TextCompressor::decode(char* dest, int dest_max, const uint8_t* src, int src_len, int& consumed) {
+  int o = 0, i = 0;
+  while (i < src_len && src[i] != 0) {
+    uint8_t c = src[i++];
+    if (c <= TXT_RAW_MAX) {
+      if (i + c > src_len || o + c >= dest_max) return -1;
+      memcpy(&dest[o], &src[i], c);
+      o += c; i += c;
+    } else if (c < 0x80) {
+      if (o + 1 >= dest_max) return -1;
+      dest[o++] = c;
+    } else {
+      const char* s = txt_dict[c & 0x7F];
+      int n = strlen(s);
+      if (o + n >= dest_max) return -1;
+      memcpy(&dest[o], s, n);
+      o += n;
+    }
+  }
+  dest[o] = 0;
+  consumed = i;
+  return o;
+}
+
+int TextCompressor::expandTxtPayload(uint8_t* data, int len, int buf_size) {
+  if (len <= 5) return 0;
+
+  char text[MAX_PACKET_PAYLOAD];
+  int consumed;
+  int n = decode(text, sizeof(text), &data[5], len - 5, consumed);
+  if (n < 0 || 5 + n + 2 >= buf_size) return 0;   // invalid, or too long (caller may also append a null)
+
+  uint8_t attempt = (5 + consumed + 1 < len) ? data[5 + consumed + 1] : 0;  // optional attempt byte after terminator
+  data[4] &= ~(TXT_FLAG_COMPRESSED << 2);
+  memcpy(&data[5], text, n);
+  data[5 + n] = 0;
+  data[5 + n + 1] = attempt;
+  return 5 + n + 2;
+}
@@ -2,14 +2,48 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #define TXT_TYPE_PLAIN          0    // a plain text message
 #define TXT_TYPE_CLI_DATA       1    // a CLI command
 #define TXT_TYPE_SIGNED_PLAIN   2    // plain text, signed by sender
 
+#define TXT_FLAG_COMPRESSED  0x20   // (in upper 6 bits of flags byte) text is encoded with TextCompressor
+
 class StrHelper {
 public:
   static void strncpy(char* dest, const char* src, size_t buf_sz);
   static void strzcpy(char* dest, const char* src, size_t buf_sz);   // pads with trailing nulls
   static const char* ftoa(float f);
 };
+
+/**
+ * \brief  A static-dictionary short string compressor, tuned for chat text. Encoded output never contains a zero byte,
+ *          so it can be followed by a null terminator (or the zero padding from decryption).
+ *     0x01..0x08 :  next 1..8 bytes are raw (eg. UTF-8 or control chars)
+ *     0x09..0x7F :  literal ASCII char
+ *     0x80..0xFF :  dictionary entry
+*/
+class TextCompressor {
+public:
+  /**
+   * \returns  length of encoded bytes in 'dest', or zero if it won't fit in 'dest_max'
+  */
+  static int encode(uint8_t* dest, int dest_max, const char* src, int src_len);
+
+  /**
+   * \brief  decodes until a zero byte, or 'src_len'. Result in 'dest' is null terminated.
+   * \param  consumed  (out) number of 'src' bytes that were decoded (excluding terminator)
+   * \returns  length of decoded text, or -1 if invalid, or it won't fit in 'dest_max' (including terminator)
+  */
+  static int decode(char* dest, int dest_max, const uint8_t* src, int src_len, int& consumed);
+
+  /**
+   * \brief  in-place expansion of a TXT_MSG/GRP_TXT plaintext with TXT_FLAG_COMPRESSED set:
+   *          timestamp(4) | flags(1) | encoded text | [0 | attempt]
+   *          Result has the TXT_FLAG_COMPRESSED cleared, and the text (and any trailing attempt byte) decoded.
+   * \param  buf_size  size of 'data' buffer
+   * \returns  new length of data, or zero if invalid
+  */
+  static int expandTxtPayload(uint8_t* data, int len, int buf_size);
+};
@@ -34,3 +34,20 @@ void BridgeBase::handleReceivedPacket(mesh::Packet *packet) {
     _mgr->free(packet);
   }
 }
+
+void BridgeBase::handleReceivedPackets(mesh::Packet *packets[], int count) {
+  uint8_t hashes[BRIDGE_RX_BATCH][MAX_HASH_SIZE];
+  uint8_t *hash_ptrs[BRIDGE_RX_BATCH];
+  for (int i = 0; i < count; i++) {
+    hash_ptrs[i] = hashes[i];
+  }
+  mesh::Packet::calculatePacketHashes(count, packets, hash_ptrs);
+
+  for (int i = 0; i < count; i++) {
+    if (!_seen_packets.hasSeen(packets[i], hashes[i])) {
+      _mgr->queueInbound(packets[i], millis() + BRIDGE_DELAY);
+    } else {
+      _mgr->free(packets[i]);
+    }
+  }
+}
@@ -49,6 +49,11 @@ public:
    */
   static constexpr uint16_t BRIDGE_DELAY = 500; // TODO: maybe too high ?
 
+  /**
+   * @brief Max received packets handled together by handleReceivedPackets()
+   */
+  static constexpr int BRIDGE_RX_BATCH = 8;
+
 protected:
   /** Packet manager for allocating and queuing mesh packets */
   mesh::PacketManager *_mgr;
@@ -109,4 +114,15 @@ protected:
    * @param packet The received mesh packet
    */
   void handleReceivedPacket(mesh::Packet *packet);
+
+  /**
+   * @brief Same as handleReceivedPacket(), for a backlog of packets drained together
+   *
+   * Their hashes for duplicate detection are calculated in one pass, which hashes
+   * several packets in parallel on hosts with SIMD (see Packet::calculatePacketHashes()).
+   *
+   * @param packets The received mesh packets
+   * @param count Number of packets, up to BRIDGE_RX_BATCH
+   */
+  void handleReceivedPackets(mesh::Packet *packets[], int count);
 };
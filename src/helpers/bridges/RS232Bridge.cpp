@@ -72,6 +72,9 @@ void RS232Bridge::onPacketTransmitted(mesh::Packet *packet) {
 }
 
 void RS232Bridge::loop() {
+  mesh::Packet *batch[BRIDGE_RX_BATCH];   // packets drained from serial backlog, handled together
+  int batch_len = 0;
+
   while (_serial->available()) {
     uint8_t b = _serial->read();
 
@@ -115,7 +118,11 @@ void RS232Bridge::loop() {
             mesh::Packet *pkt = _mgr->allocNew();
             if (pkt) {
               if (pkt->readFrom(_rx_buffer + 4, len)) {
-                onPacketReceived(pkt);
+                batch[batch_len++] = pkt;
+                if (batch_len == BRIDGE_RX_BATCH) {
+                  handleReceivedPackets(batch, batch_len);
+                  batch_len = 0;
+                }
               } else {
 #if MESH_PACKET_LOGGING
                 Serial.printf("%s: RS232 BRIDGE: RX failed to parse packet\n", getLogDateTime());
@@ -138,6 +145,10 @@ void RS232Bridge::loop() {
       }
     }
   }
+
+  if (batch_len > 0) {
+    handleReceivedPackets(batch, batch_len);
+  }
 }
 
 void RS232Bridge::onPacketReceived(mesh::Packet *packet) {
@@ -0,0 +1,112 @@
+// Host benchmark of ErasureCode (FragmentTransfer's coded mode): round-trips blobs of several sizes, with every data frag
+// that the repair frags can cover dropped (worst case), checks the rebuilt blob, and reports encode/decode throughput.
+//
+// Not part of the firmware build (build_src_filter only takes src/helpers/*.cpp). Run it on a host with:
+//
+//     g++ -O2 -I src src/helpers/test/erasure_code_bench.cpp src/helpers/ErasureCode.cpp -o /tmp/ec_bench && /tmp/ec_bench
+//
+// Exits non-zero if any blob fails to round-trip.
+
+#include <helpers/ErasureCode.h>
+#include <MeshCore.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// as in FragmentTransfer.h
+#define FRAG_DATA_HDR_SIZE   8
+#define FRAG_MAX_PLAINTEXT   (MAX_PACKET_PAYLOAD - 1 - 2*MAX_PATH_HASH_SIZE - MAX_CIPHER_MAC_SIZE - (CIPHER_BLOCK_SIZE-1))
+#define FRAG_CHUNK_SIZE      (FRAG_MAX_PLAINTEXT - FRAG_DATA_HDR_SIZE)
+#define FRAG_REPAIR_PERCENT  25
+#define MAX_FRAGS            16
+
+static int calcNumRepair(int num_frags) {   // as FragmentTransfer::calcNumRepair()
+  int n = (num_frags * FRAG_REPAIR_PERCENT + 99) / 100;
+  if (n < 1) n = 1;
+  if (n > FRAG_MAX_REPAIR) n = FRAG_MAX_REPAIR;
+  return n;
+}
+
+static uint32_t rand_state = 12345;
+static uint32_t nextRand() { rand_state = rand_state * 1103515245 + 12345; return rand_state >> 8; }
+
+static uint8_t blob[MAX_FRAGS * FRAG_CHUNK_SIZE], rebuilt[MAX_FRAGS * FRAG_CHUNK_SIZE];
+static uint8_t coded[FRAG_MAX_REPAIR][FRAG_CHUNK_SIZE], repair[FRAG_MAX_REPAIR][FRAG_CHUNK_SIZE];
+
+// drops num_drop random data frags from 'rebuilt', then decodes them from the first num_drop repair frags
+static bool dropAndDecode(int num_frags, int num_drop) {
+  uint8_t received[(MAX_FRAGS + 7) / 8];
+  memset(received, 0xFF, sizeof(received));
+  memcpy(rebuilt, blob, num_frags * FRAG_CHUNK_SIZE);
+  for (int d = 0; d < num_drop; ) {
+    int i = nextRand() % num_frags;
+    if (!(received[i >> 3] & (1 << (i & 7)))) continue;   // already dropped
+    received[i >> 3] &= ~(1 << (i & 7));
+    memset(&rebuilt[i * FRAG_CHUNK_SIZE], 0, FRAG_CHUNK_SIZE);
+    d++;
+  }
+  uint8_t repair_idx[FRAG_MAX_REPAIR];
+  for (int r = 0; r < num_drop; r++) {
+    memcpy(repair[r], coded[r], FRAG_CHUNK_SIZE);
+    repair_idx[r] = num_frags + r;
+  }
+  return ErasureCode::decode(rebuilt, num_frags, FRAG_CHUNK_SIZE, received, &repair[0][0], repair_idx, num_drop);
+}
+
+int main() {
+  static const int sizes[] = { 512, 1024, 2048 };
+  int failures = 0;
+
+  printf("chunk size %d, FRAG_MAX_REPAIR %d\n", FRAG_CHUNK_SIZE, FRAG_MAX_REPAIR);
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    int len = sizes[s];
+    int num_frags = (len + FRAG_CHUNK_SIZE - 1) / FRAG_CHUNK_SIZE;
+    int num_repair = calcNumRepair(num_frags);
+    for (int i = 0; i < len; i++) blob[i] = nextRand();
+    memset(&blob[len], 0, num_frags * FRAG_CHUNK_SIZE - len);   // pad last chunk
+
+    for (int r = 0; r < num_repair; r++) {
+      ErasureCode::encodeRepair(coded[r], blob, num_frags, FRAG_CHUNK_SIZE, num_frags + r);
+    }
+    // every number of dropped frags the repair frags can cover, several random patterns each
+    for (int drop = 0; drop <= num_repair; drop++) {
+      for (int trial = 0; trial < 50; trial++) {
+        if (!dropAndDecode(num_frags, drop) || memcmp(rebuilt, blob, len) != 0) {
+          printf("FAIL: len=%d, dropped %d\n", len, drop);
+          failures++;
+        }
+      }
+    }
+    if (num_repair < num_frags) {   // one more lost than there are repair frags, must be refused
+      uint8_t received[(MAX_FRAGS + 7) / 8], repair_idx[FRAG_MAX_REPAIR];
+      memset(received, 0xFF, sizeof(received));
+      for (int i = 0; i <= num_repair; i++) received[i >> 3] &= ~(1 << (i & 7));
+      for (int r = 0; r < num_repair; r++) repair_idx[r] = num_frags + r;
+      if (ErasureCode::decode(rebuilt, num_frags, FRAG_CHUNK_SIZE, received, &repair[0][0], repair_idx, num_repair)) {
+        printf("FAIL: len=%d, decoded with too few frags\n", len);
+        failures++;
+      }
+    }
+
+    // speed: encode all repair frags (sender), decode with num_repair data frags dropped (receiver, worst case)
+    const int passes = 2000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++) {
+      for (int r = 0; r < num_repair; r++) {
+        ErasureCode::encodeRepair(coded[r], blob, num_frags, FRAG_CHUNK_SIZE, num_frags + r);
+      }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++) dropAndDecode(num_frags, num_repair);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double enc_secs = std::chrono::duration<double>(t1 - t0).count();
+    double dec_secs = std::chrono::duration<double>(t2 - t1).count();
+    double total_mb = (double) len * passes / 1e6;
+    printf("len %4d: %2d+%d frags, encode %6.1f MB/s (%7.1f us/blob), decode %d lost %6.1f MB/s (%7.1f us/blob)\n",
+           len, num_frags, num_repair, total_mb / enc_secs, enc_secs * 1e6 / passes,
+           num_repair, total_mb / dec_secs, dec_secs * 1e6 / passes);
+  }
+  printf("%s\n", failures ? "FAILED" : "all round trips passed");
+  return failures ? 1 : 0;
+}
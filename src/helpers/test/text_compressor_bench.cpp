@@ -0,0 +1,144 @@
+// Host benchmark of TextCompressor: compression ratio, cipher blocks saved, and encode/decode speed, over a corpus of
+// typical mesh chat messages (short, informal, some UTF-8 and emoji). Each message is also round-tripped.
+//
+// Not part of the firmware build (build_src_filter only takes src/helpers/*.cpp). Run it on a host with:
+//
+//     g++ -O2 -I src src/helpers/test/text_compressor_bench.cpp src/helpers/TextCompressor.cpp -o /tmp/txt_bench && /tmp/txt_bench
+//
+// Exits non-zero if any message fails to round-trip.
+
+#include <helpers/TxtDataHelpers.h>
+#include <MeshCore.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define TXT_HDR_SIZE   5   // timestamp(4) | flags(1), precedes text in TXT_MSG/GRP_TXT plaintext
+
+static const char* const corpus[] = {
+  "ok",
+  "test",
+  "Test from the hill, anyone hear me?",
+  "Hi all, just got my node set up on the roof",
+  "Good morning everyone!",
+  "Copy that, you are coming through loud and clear",
+  "Is anyone on the mesh near the harbour today?",
+  "I'm heading out now, will check in later",
+  "Thanks, that worked :)",
+  "What antenna are you using on the repeater?",
+  "The new firmware is working well so far",
+  "Can you see my position on the map?",
+  "Signal is weak here, only one hop to the tower",
+  "Battery at 40%, going to charge it tonight",
+  "Who is running the repeater on the ridge? It has been great",
+  "I'll be at the meetup on Saturday at 10am",
+  "Roads are closed after the storm, take the north route",
+  "Anyone else seeing lots of packets dropped this evening?",
+  "Thank you for the help with the settings",
+  "Did you get my last message? I didn't get an ack",
+  "Heading home now, talk to you tomorrow",
+  "Nice, the range on that is impressive",
+  "We should put another node on the water tower",
+  "Can't make it tonight, sorry",
+  "Where is the best place to mount the antenna?",
+  "Power is out in our area, running on solar",
+  "The weather is clearing up, should be a good day for it",
+  "Yes! It's working now",
+  "No worries, happy to help",
+  "I think the room server was restarted, messages are back",
+  "How many hops is it from you to the city?",
+  "All good here, standing by",
+  "Just testing the new channel, please ignore",
+  "Message received, thanks",
+  "Is there a repeater near the lake?",
+  "Checking in from the car park, on the way up",
+  "Reached the summit, great view and full signal",
+  "Will you be on the net tonight?",
+  "That sounds like a good plan, let's do it",
+  "My node keeps rebooting, any ideas?",
+  "Try lowering the transmit power and see if it helps",
+  "Happy birthday! \xF0\x9F\x8E\x89",
+  "On my way \xF0\x9F\x9A\x97",
+  "Caf\xC3\xA9 on the corner at 3pm?",
+  "Temp 18.5C, wind 12 km/h NW",
+  "GPS: -33.8688, 151.2093",
+  "Reply to @alice: yes, see you there",
+  "Please keep this channel for emergency traffic only",
+  "Road to the hut is passable with a 4WD",
+  "Sorry, I was out of range for a while",
+};
+
+#define NUM_MESSAGES  (sizeof(corpus) / sizeof(corpus[0]))
+
+static int calcBlocks(int len) { return (len + CIPHER_BLOCK_SIZE - 1) / CIPHER_BLOCK_SIZE; }
+
+int main() {
+  uint8_t enc[MAX_PACKET_PAYLOAD];
+  char dec[MAX_PACKET_PAYLOAD];
+  int raw_bytes = 0, enc_bytes = 0, all_enc_bytes = 0, raw_blocks = 0, sent_blocks = 0, num_compressed = 0, failures = 0;
+
+  for (size_t m = 0; m < NUM_MESSAGES; m++) {
+    const char* text = corpus[m];
+    int text_len = strlen(text);
+    int enc_len = TextCompressor::encode(enc, text_len, text, text_len);   // same limit as BaseChatMesh: no bigger than the text
+    int consumed;
+    int dec_len = enc_len > 0 ? TextCompressor::decode(dec, sizeof(dec), enc, enc_len, consumed) : -1;
+
+    if (enc_len > 0 && (dec_len != text_len || memcmp(dec, text, text_len) != 0)) {
+      printf("FAIL: round trip of \"%s\"\n", text);
+      failures++;
+    }
+
+    // as in BaseChatMesh::composeMsgPacket(): only sent compressed if it saves at least one cipher block
+    int blocks = calcBlocks(TXT_HDR_SIZE + text_len);
+    raw_bytes += text_len;
+    all_enc_bytes += enc_len > 0 ? enc_len : text_len;
+    raw_blocks += blocks;
+    if (enc_len > 0 && calcBlocks(TXT_HDR_SIZE + enc_len) < blocks) {
+      num_compressed++;
+      enc_bytes += enc_len;
+      sent_blocks += calcBlocks(TXT_HDR_SIZE + enc_len);
+    } else {
+      enc_bytes += text_len;
+      sent_blocks += blocks;
+    }
+  }
+
+  // speed: many passes over the whole corpus
+  const int passes = 2000;
+  volatile int sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++) {
+    for (size_t m = 0; m < NUM_MESSAGES; m++) {
+      int n = strlen(corpus[m]);
+      sink += TextCompressor::encode(enc, n, corpus[m], n);
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  int enc_lens[NUM_MESSAGES];
+  uint8_t encoded[NUM_MESSAGES][MAX_PACKET_PAYLOAD];
+  for (size_t m = 0; m < NUM_MESSAGES; m++) {
+    int n = strlen(corpus[m]);
+    enc_lens[m] = TextCompressor::encode(encoded[m], sizeof(encoded[m]), corpus[m], n);
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++) {
+    for (size_t m = 0; m < NUM_MESSAGES; m++) {
+      int consumed;
+      sink += TextCompressor::decode(dec, sizeof(dec), encoded[m], enc_lens[m], consumed);
+    }
+  }
+  auto t3 = std::chrono::steady_clock::now();
+
+  double enc_secs = std::chrono::duration<double>(t1 - t0).count();
+  double dec_secs = std::chrono::duration<double>(t3 - t2).count();
+  double total_mb = (double) raw_bytes * passes / 1e6;
+
+  printf("messages:      %d, %d compressed (saving >= 1 cipher block)\n", (int) NUM_MESSAGES, num_compressed);
+  printf("encoded bytes: %d -> %d (%.1f%% smaller)\n", raw_bytes, all_enc_bytes, 100.0 * (raw_bytes - all_enc_bytes) / raw_bytes);
+  printf("text bytes:    %d -> %d as sent (%.1f%% smaller)\n", raw_bytes, enc_bytes, 100.0 * (raw_bytes - enc_bytes) / raw_bytes);
+  printf("cipher blocks: %d -> %d (%.1f%% fewer)\n", raw_blocks, sent_blocks, 100.0 * (raw_blocks - sent_blocks) / raw_blocks);
+  printf("encode:        %.1f MB/s, %.2f us/message\n", total_mb / enc_secs, enc_secs * 1e6 / (passes * NUM_MESSAGES));
+  printf("decode:        %.1f MB/s, %.2f us/message\n", total_mb / dec_secs, dec_secs * 1e6 / (passes * NUM_MESSAGES));
+  return failures ? 1 : 0;
+}